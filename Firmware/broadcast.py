@@ -0,0 +1,193 @@
+from Crypto.Cipher import AES
+import struct
+import sys
+
+# Signed broadcasts as parsed by the firmware (broadcast_frame.c), sent as
+# manufacturer data of a non-connectable advertising packet:
+#   0xFF company_lo company_hi version counter[4] target addr[3] commands tag[4]
+# The commands are TLV8, the tag is the first 4 bytes of an AES-128 CBC-MAC
+# over length, version ... commands, zero padded to 16 bytes
+
+COMPANY_ID = 0xFFFF
+VERSION = 1
+TAG_LEN = 4
+HEADER_LEN = 9
+MAX_LEN = 27
+
+TARGET_ALL = 0
+TARGET_MAC = 1
+TARGET_GROUP = 2
+
+CMD_SLOT = 0x01
+CMD_TIME = 0x02
+CMD_FIELD = 0x03
+CMD_TEMPLATE = 0x04
+
+
+def cbc_mac(key, data):
+    aes = AES.new(key, AES.MODE_ECB)
+    msg = bytes((len(data) & 0xff,)) + data
+    msg += b"\x00" * (-len(msg) % 16)
+    mac = bytes(16)
+    for i in range(0, len(msg), 16):
+        mac = aes.encrypt(bytes(a ^ b for a, b in zip(mac, msg[i:i + 16])))
+    return mac
+
+
+def slot(index, full_or_partial=1):
+    return (CMD_SLOT, bytes((index, full_or_partial)))
+
+
+def time_sync(unix_time):
+    return (CMD_TIME, struct.pack(">I", unix_time))
+
+
+def field(index, text):
+    # Sets a field of the label templates, shown with the next template()
+    return (CMD_FIELD, bytes((index,)) + text.encode("ascii"))
+
+
+def template(index, full_or_partial=1):
+    return (CMD_TEMPLATE, bytes((index, full_or_partial)))
+
+
+def mac_target(mac):
+    # mac as printed, "A4:C1:38:12:34:56", the label matches the last three bytes
+    parts = bytes(int(b, 16) for b in mac.split(":"))
+    return TARGET_MAC, parts[-3:]
+
+
+def group_target(group):
+    return TARGET_GROUP, struct.pack(">HB", group, 0)
+
+
+def encode(key, counter, commands, target=(TARGET_ALL, b"\x00\x00\x00"), tail=b""):
+    # counter has to grow from one packet to the next a label is addressed by,
+    # tail is appended to the commands as is
+    body = bytes((VERSION,)) + struct.pack(">I", counter) + bytes((target[0],)) + target[1]
+    for cmd, value in commands:
+        body += bytes((cmd, len(value))) + value
+    body += tail
+    payload = body + cbc_mac(key, body)[:TAG_LEN]
+    if len(payload) > MAX_LEN:
+        raise ValueError("%d bytes do not fit one advertising packet" % len(payload))
+    return bytes((len(payload) + 3, 0xFF, COMPANY_ID & 0xff, COMPANY_ID >> 8)) + payload
+
+
+def decode(key, adv):
+    # Returns (counter, target, addr, [(cmd, value)]) or None, like bcast_find + bcast_parse
+    payload = None
+    pos = 0
+    while pos + 1 < len(adv) and adv[pos]:
+        ad_len = adv[pos]
+        if pos + 1 + ad_len > len(adv):
+            break
+        if ad_len > 3 and adv[pos + 1] == 0xFF and adv[pos + 2:pos + 4] == bytes((COMPANY_ID & 0xff, COMPANY_ID >> 8)):
+            payload = adv[pos + 4:pos + 1 + ad_len]
+            break
+        pos += 1 + ad_len
+    if payload is None:
+        return None
+    if len(payload) < HEADER_LEN + TAG_LEN or len(payload) > MAX_LEN or payload[0] != VERSION:
+        return None
+    if cbc_mac(key, payload[:-TAG_LEN])[:TAG_LEN] != payload[-TAG_LEN:]:
+        return None
+    cmds = []
+    data = payload[HEADER_LEN:-TAG_LEN]
+    i = 0
+    while i + 2 <= len(data) and i + 2 + data[i + 1] <= len(data):
+        cmds.append((data[i], data[i + 2:i + 2 + data[i + 1]]))
+        i += 2 + data[i + 1]
+    return struct.unpack(">I", payload[1:5])[0], payload[5], payload[6:9], cmds
+
+
+class Receiver:
+    # What a label does with a packet, for checking a transmitter without hardware
+    def __init__(self, key, mac, groups=()):
+        self.key = key
+        self.mac = mac_target(mac)[1]
+        self.groups = groups
+        self.counter = 0
+        self.actions = []
+
+    def receive(self, adv):
+        # Only packets addressed to this label move its counter, like bcast_accept
+        frame = decode(self.key, adv)
+        if not frame:
+            return False
+        group = struct.unpack(">H", frame[2][:2])[0]
+        if frame[1] == TARGET_MAC and frame[2] != self.mac:
+            return False
+        if frame[1] == TARGET_GROUP and (not group or group not in self.groups):
+            return False
+        if frame[1] not in (TARGET_ALL, TARGET_MAC, TARGET_GROUP):
+            return False
+        if frame[0] <= self.counter:
+            return False
+        self.counter = frame[0]
+        self.actions += frame[3]
+        return True
+
+
+def packets(key):
+    # What the simulation below sends, also the packets of test/test_broadcast.c
+    forged = bytearray(encode(key, 104, [slot(7)]))
+    forged[-5] ^= 1
+    return [
+        ("everyone", encode(key, 100, [time_sync(1700000000), slot(3)])),
+        ("only_b", encode(key, 101, [slot(5, 0)], mac_target("A4:C1:38:00:00:02"))),
+        ("group_9", encode(key, 102, [slot(6)], group_target(9))),
+        ("price", encode(key, 103, [field(0, "4.99"), template(0, 0)], group_target(7))),
+        ("forged", bytes(forged)),
+        ("wrong_key", encode(bytes(16), 105, [slot(7)])),
+        ("old", encode(key, 99, [slot(1)])),
+        # one transmitter going through its labels, a hears the others first
+        ("for_a", encode(key, 110, [slot(10)], mac_target("A4:C1:38:00:00:01"))),
+        ("for_b", encode(key, 111, [slot(11)], mac_target("A4:C1:38:00:00:02"))),
+        ("group_8", encode(key, 112, [slot(12)], group_target(8))),
+        # signed, but the second command claims more bytes than there are
+        ("cut_tlv", encode(key, 120, [slot(13)], tail=bytes((CMD_SLOT, 5, 14)))),
+    ]
+
+
+def c_header(key):
+    lines = ["// Generated by: python3 broadcast.py --c > test/broadcast_packets.h",
+             "static const uint8_t bcast_test_key[16] = {%s};" % ", ".join("0x%02x" % b for b in key)]
+    for name, adv in packets(key):
+        lines.append("static const uint8_t bcast_%s[] = {%s};" % (name, ", ".join("0x%02x" % b for b in adv)))
+    return "\n".join(lines)
+
+
+if __name__ == "__main__":
+    # Simulated receivers, e.g.: python broadcast.py 000102030405060708090a0b0c0d0e0f
+    # or the packets as C arrays: python broadcast.py --c
+    if len(sys.argv) > 1 and sys.argv[1] == "--c":
+        print(c_header(bytes(range(16))))
+        sys.exit(0)
+    key = bytes.fromhex(sys.argv[1]) if len(sys.argv) > 1 else bytes(range(16))
+    p = dict(packets(key))
+    a = Receiver(key, "A4:C1:38:00:00:01", groups=(7,))
+    b = Receiver(key, "A4:C1:38:00:00:02", groups=(8, 9))
+
+    assert a.receive(p["everyone"]) and b.receive(p["everyone"])
+    assert not a.receive(p["everyone"]), "repeat accepted"
+    assert not a.receive(p["only_b"]) and b.receive(p["only_b"])
+    assert a.counter == 100, "counter moved by a packet for another label"
+    assert not a.receive(p["group_9"]) and b.receive(p["group_9"])
+    assert a.receive(p["price"]) and not b.receive(p["price"])
+    assert not a.receive(p["forged"]), "tampered packet accepted"
+    assert not a.receive(p["wrong_key"]), "wrong key accepted"
+    assert not b.receive(p["old"]), "old counter accepted"
+
+    for name in ("group_8", "for_b", "for_a"):
+        assert a.receive(p[name]) == (name == "for_a"), name
+    for name in ("for_a", "for_b", "group_8"):
+        assert b.receive(p[name]) == (name != "for_a"), name
+    assert a.receive(p["cut_tlv"])
+
+    common = [(CMD_TIME, struct.pack(">I", 1700000000)), (CMD_SLOT, b"\x03\x01")]
+    assert a.actions == common + [(CMD_FIELD, b"\x004.99"), (CMD_TEMPLATE, b"\x00\x00"), (CMD_SLOT, b"\x0a\x01"),
+                                  (CMD_SLOT, b"\x0d\x01")]
+    assert b.actions == common + [(CMD_SLOT, b"\x05\x00"), (CMD_SLOT, b"\x06\x01"), (CMD_SLOT, b"\x0b\x01"),
+                                  (CMD_SLOT, b"\x0c\x01")]
+    print("ok, %d byte packet: %s" % (len(p["everyone"]), p["everyone"].hex()))
@@ -0,0 +1,146 @@
+import re
+import sys
+
+# Font compiler: turns an Adafruit GFX font header, like the ones in src/,
+# into one that only holds the characters a deployment needs, e.g.:
+#   python fontc.py src/Roboto_Black_80.h Roboto_Black_80_price "0123456789.,-%" > src/font_80_price.h
+# Glyphs are RLE compressed as OneBitDisplay.h describes for OBD_FONT_RLE,
+# unless plain bitmaps come out smaller for the font
+
+RLE_MAX_WIDTH = 128  # OBD_RLE_MAX_WIDTH
+
+
+def parse(path):
+    src = open(path).read()
+    bitmaps = src[src.index("Bitmaps[]"):src.index("Glyphs[]")]
+    bitmaps = re.sub(r"//[^\n]*", "", bitmaps[bitmaps.index("{") + 1:bitmaps.index("};")])
+    bitmap = bytes(int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", bitmaps))
+    table = src[src.index("Glyphs[]"):]
+    table = table[:table.index("};")]
+    glyphs = [tuple(int(v) for v in m.groups()) for m in re.finditer(
+        r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", table)]
+    font = src[src.rindex("const GFXfont"):]
+    font = font[font.index("Glyphs") + len("Glyphs"):font.index("}")]
+    first, last, y_advance = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", font)[:3]]
+    # Some generators claim one character more than they have glyphs for
+    last = min(last, first + len(glyphs) - 1)
+    return bitmap, glyphs[:last - first + 1], first, y_advance
+
+
+def rows(bitmap, glyph):
+    offset, width, height = glyph[:3]
+    bit = lambda i: (bitmap[offset + i // 8] >> (7 - i % 8)) & 1
+    return [tuple(bit(y * width + x) for x in range(width)) for y in range(height)]
+
+
+def pack(glyph_rows):
+    # Plain Adafruit GFX layout, rows run on without padding
+    bits = [b for row in glyph_rows for b in row]
+    return bytes(sum(b << (7 - i) for i, b in enumerate(bits[pos:pos + 8])) for pos in range(0, len(bits), 8))
+
+
+def rle_encode(glyph_rows):
+    height = len(glyph_rows)
+    flags = bytearray((height + 7) // 8)
+    bits = []
+    for y, row in enumerate(glyph_rows):
+        if y and row == glyph_rows[y - 1]:
+            flags[y // 8] |= 0x80 >> (y % 8)
+        else:
+            bits += row
+    nibbles = []
+    ink, pos = 0, 0
+    while pos < len(bits):
+        run = 0
+        while pos < len(bits) and bits[pos] == ink:
+            run += 1
+            pos += 1
+        while run >= 15:
+            nibbles.append(15)
+            run -= 15
+        nibbles.append(run)
+        ink ^= 1
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return bytes(flags) + bytes(nibbles[i] << 4 | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def rle_decode(data, width, height):
+    # What obdRLERow() does, to check the encoder
+    flags, runs = data[:(height + 7) // 8], data[(height + 7) // 8:]
+    nibbles = [n for b in runs for n in (b >> 4, b & 15)]
+    pixels = []
+    ink, toggle = 0, False
+    for n in nibbles:
+        if toggle:
+            ink ^= 1
+        pixels += [ink] * n
+        toggle = n < 15
+    out = []
+    for y in range(height):
+        if flags[y // 8] & (0x80 >> (y % 8)):
+            out.append(out[-1])
+        else:
+            out.append(tuple(pixels[:width]))
+            pixels = pixels[width:]
+    return out
+
+
+def compile_font(bitmap, glyphs, first, chars):
+    codes = sorted(set(ord(c) for c in chars if first <= ord(c) < first + len(glyphs)))
+    if not codes:
+        raise ValueError("none of the characters are in the font")
+    subset = {c: rows(bitmap, glyphs[c - first]) for c in codes}
+    rle = all(glyphs[c - first][1] <= RLE_MAX_WIDTH for c in codes)
+    if rle:
+        data = {c: rle_encode(r) for c, r in subset.items()}
+        for c, r in subset.items():
+            assert rle_decode(data[c], len(r[0]) if r else 0, len(r)) == r, chr(c)
+        rle = sum(map(len, data.values())) < sum(len(pack(r)) for r in subset.values())
+    if not rle:
+        data = {c: pack(r) for c, r in subset.items()}
+
+    out_bitmap = bytearray()
+    out_glyphs = []
+    for c in range(codes[0], codes[-1] + 1):
+        if c not in data:  # gaps of the range draw nothing
+            out_glyphs.append((chr(c), (0, 0, 0, 0, 0, 0)))
+            continue
+        out_glyphs.append((chr(c), (len(out_bitmap),) + glyphs[c - first][1:]))
+        out_bitmap += data[c]
+    if len(out_bitmap) > 0xffff:
+        raise ValueError("bitmap offsets do not fit 16 bits")
+    return out_bitmap, out_glyphs, codes[0], codes[-1], rle
+
+
+def header(name, source, bitmap, glyphs, first, last, y_advance, rle):
+    lines = ["// Generated by fontc.py from %s, do not edit" % source,
+             "const uint8_t %sBitmaps[] = {" % name]
+    for pos in range(0, len(bitmap), 16):
+        lines.append("\t" + ",".join("0x%02X" % b for b in bitmap[pos:pos + 16]) + ",")
+    lines += ["};",
+              "const GFXglyph %sGlyphs[] = {" % name,
+              "// bitmapOffset, width, height, xAdvance, xOffset, yOffset"]
+    for c, g in glyphs:
+        lines.append("\t  { %5d, %3d, %3d, %3d, %4d, %4d }, // %r" % (g + (c,)))
+    lines += ["};",
+              "const GFXfont %s = {" % name,
+              "(uint8_t  *)%sBitmaps,(GFXglyph *)%sGlyphs,0x%02X, 0x%02X, %d, %s};" % (
+                  name, name, first, last, y_advance, "OBD_FONT_RLE" if rle else "0"),
+              ""]
+    return "\n".join(lines)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        sys.exit("usage: fontc.py font.h name [characters] > out.h")
+    path, name = sys.argv[1], sys.argv[2]
+    bitmap, glyphs, first, y_advance = parse(path)
+    chars = sys.argv[3] if len(sys.argv) > 3 else "".join(chr(first + i) for i in range(len(glyphs)))
+    out_bitmap, out_glyphs, out_first, out_last, rle = compile_font(bitmap, glyphs, first, chars)
+    sys.stdout.write(header(name, path.replace("\\", "/").split("/")[-1], out_bitmap, out_glyphs,
+                            out_first, out_last, y_advance, rle))
+    # GFXglyph is 7 bytes with -fpack-struct
+    print("%s: %d glyphs, %d + %d bytes (was %d + %d)%s" % (
+        name, sum(1 for _, g in out_glyphs if g[1]), len(out_bitmap), 7 * len(out_glyphs),
+        len(bitmap), 7 * len(glyphs), ", RLE" if rle else ""), file=sys.stderr)
@@ -0,0 +1,94 @@
+from PIL import Image
+import io
+import sys
+import time
+
+# PackBits as unpacked by the firmware (epd_plane.c): a header byte h < 0x80
+# is followed by h + 1 literal bytes, h >= 0x80 by one byte that repeats
+# h - 0x80 + 3 times
+
+EPD_WIDTH = 250  # lines of epd_buffer
+EPD_LINE_BYTES = 16  # bytes per line, 128 pixels
+
+
+def encode(data):
+    out = bytearray()
+    i = 0
+    size = len(data)
+    while i < size:
+        run = 1
+        while i + run < size and run < 130 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out += bytes((0x80 + run - 3, data[i]))
+            i += run
+            continue
+
+        # Literal bytes up to the next run of 3
+        lit = 1
+        while i + lit < size and lit < 128:
+            if i + lit + 2 < size and data[i + lit] == data[i + lit + 1] == data[i + lit + 2]:
+                break
+            lit += 1
+        out.append(lit - 1)
+        out += data[i:i + lit]
+        i += lit
+    return bytes(out)
+
+
+def decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        h = data[i]
+        if h < 0x80:
+            out += data[i + 1:i + 2 + h]
+            i += h + 2
+        else:
+            out += bytes((data[i + 1],)) * (h - 0x80 + 3)
+            i += 2
+    return bytes(out)
+
+
+def epd_frame(img):
+    # Rotated 90 deg like TIFFDraw: column x of the image is line 249 - x, black = 0
+    img = img.convert("1")
+    frame = bytearray(b"\xff" * (EPD_WIDTH * EPD_LINE_BYTES))
+    w = min(img.width, EPD_WIDTH)
+    h = min(img.height, EPD_LINE_BYTES * 8)
+    px = img.load()
+    for x in range(w):
+        line = (EPD_WIDTH - 1 - x) * EPD_LINE_BYTES
+        for y in range(h):
+            if not px[x, y]:
+                frame[line + y // 8] &= ~(0x80 >> (y & 7))
+    return bytes(frame)
+
+
+def packets(data, byte_pos=0, payload=19):
+    # Writes for the EPD characteristic: set byte_pos, then 0x08 and 0x09 pieces
+    out = [bytes((0x02, byte_pos >> 8, byte_pos & 0xff))]
+    for i in range(0, len(data), payload):
+        out.append(bytes((0x08 if i == 0 else 0x09,)) + data[i:i + payload])
+    return out
+
+
+def g4_size(img):
+    with io.BytesIO() as output:
+        img.convert("1").save(output, format="TIFF", compression="group4")
+        return len(output.getvalue())
+
+
+if __name__ == "__main__":
+    # Ratio and encode throughput, e.g.: python packbits.py mn.png stn.png test.png
+    for path in sys.argv[1:]:
+        img = Image.open(path)
+        frame = epd_frame(img)
+        start = time.perf_counter()
+        for _ in range(20):
+            packed = encode(frame)
+        elapsed = (time.perf_counter() - start) / 20
+        assert decode(packed) == frame
+        print("%-12s raw %5d  packbits %5d (%4.1f%%, %d writes)  g4 tiff %5d  encode %.1f ms" % (
+            path, len(frame), len(packed), 100.0 * len(packed) / len(frame),
+            len(packets(packed)), g4_size(img), elapsed * 1000))
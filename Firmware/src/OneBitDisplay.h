@@ -21,9 +21,18 @@ typedef struct {
   uint8_t first;    ///< ASCII extents (first char)
   uint8_t last;     ///< ASCII extents (last char)
   uint8_t yAdvance; ///< Newline distance (y axis)
+  uint8_t flags;    ///< OBD_FONT_RLE, 0 for plain Adafruit GFX fonts
 } GFXfont;
 #endif // _ADAFRUIT_GFX_H
 
+// Glyph bitmaps as written by fontc.py: (height + 7) / 8 bytes of flags, MSB
+// first, for rows that repeat the row above, then the pixels of the other rows
+// as 4 bit run lengths, high nibble first. Runs alternate between background
+// and ink starting with background, a run of 15 is followed by more of the
+// same color. RLE glyphs are at most OBD_RLE_MAX_WIDTH pixels wide
+#define OBD_FONT_RLE 0x01
+#define OBD_RLE_MAX_WIDTH 128
+
 typedef struct obdstruct
 {
 uint8_t oled_addr; // requested address or 0xff for automatic detection
@@ -123,6 +132,7 @@ enum {
   LCD_HX1230,
   LCD_NOKIA5110,
   LCD_VIRTUAL,
+  LCD_VIRTUAL_EPD, // virtual display in e-paper frame buffer layout
   SHARP_144x168,
   SHARP_400x240
 };
@@ -154,6 +164,14 @@ enum {
 // The memory buffer must be provided at the time of creation
 //
 void obdCreateVirtualDisplay(OBDISP *pOBD, int width, int height, uint8_t *buffer);
+//
+// Create a virtual display that draws straight into an e-paper frame buffer:
+// rotated by 90 degrees with one byte row per display column, the rightmost
+// column first, MSB on top and color 1 (black) stored as 0
+// Only obdFill, obdSetPixel, obdDrawLine, obdRectangle and
+// obdWriteStringCustom know this layout
+//
+void obdCreateVirtualEPD(OBDISP *pOBD, int width, int height, uint8_t *buffer);
 // Constants for the obdCopy() function
 // Output format options -
 #define OBD_LSB_FIRST     0x001
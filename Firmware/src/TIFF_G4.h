@@ -31,9 +31,16 @@
 //
 
 /* Defines and variables */
+// The buffers can be sized for the panel from the makefile
+#ifndef MAX_BUFFERED_PIXELS
 #define MAX_BUFFERED_PIXELS 1024
+#endif
+#ifndef FILE_BUF_SIZE
 #define FILE_BUF_SIZE 2048
+#endif
+#ifndef MAX_IMAGE_WIDTH
 #define MAX_IMAGE_WIDTH 2600
+#endif
 #define FILE_HIGHWATER ((FILE_BUF_SIZE * 3) >> 2)
 #define TIFF_TAG_SIZE 12
 #define MAX_TIFF_TAGS 128
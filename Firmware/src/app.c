@@ -11,6 +11,9 @@
 #include "flash.h"
 #include "ota.h"
 #include "epd.h"
+#include "epd_ble_service.h"
+#include "schedule.h"
+#include "broadcast.h"
 #include "time.h"
 #include "bart_tif.h"
 #include "OneBitDisplay.h"
@@ -30,7 +33,9 @@ _attribute_ram_code_ void user_init_normal(void) {                            //
     random_generator_init(); // must
     init_time();
     init_ble();
+    init_broadcast();
     init_flash();
+    init_schedule();
     init_nfc();
 
     display_bitmap("%boot%", 0);
@@ -47,13 +52,21 @@ _attribute_ram_code_ void main_loop(void)
 {
     blt_sdk_main_loop();
     handler_time();
+    ble_link_handler();
+    schedule_handler();
 
-    if (epd_state_handler()) // if epd_update is ongoing enable gpio wakeup to put the display to sleep as fast as possible
+    if (epd_state_handler()) // if epd_update is ongoing only suspend until its next step is due
+    {
+        epd_set_wakeup();
+    }
+    else if (broadcast_handler()) // scanning for broadcasts needs the MCU awake
     {
-        cpu_set_gpio_wakeup(EPD_BUSY, 1, 1);
-        bls_pm_setWakeupSource(PM_WAKEUP_PAD);
         bls_pm_setSuspendMask(SUSPEND_DISABLE);
     }
+    else if (epd_ble_xfer_pending()) // keep epd_buffer for a host that resumes its upload
+    {
+        bls_pm_setSuspendMask(SUSPEND_ADV | SUSPEND_CONN);
+    }
     else
     {
         blt_pm_proc();
@@ -70,9 +70,9 @@ typedef enum
 	//// EPD_BLE ////
 	/**********************************************************************************************/
 	EPD_BLE_PS_H, 								//UUID: , 	VALUE: EPD_BLE service uuid
-	EPD_BLE_CMD_OUT_CD_H,						//UUID: , 	VALUE:  			Prop: write_without_rsp
+	EPD_BLE_CMD_OUT_CD_H,						//UUID: , 	VALUE:  			Prop: write_without_rsp | notify
 	EPD_BLE_CMD_OUT_DP_H,						//UUID: EPD_BLE uuid,  VALUE: EPD_BLEData
-	EPD_BLE_CMD_OUT_DESC_H,						//UUID: , 	VALUE: EPD_BLEName
+	EPD_BLE_CMD_OUT_DESC_H,						//UUID: 2902, 	VALUE: EPD_BLE CCC
 
 	ATT_END_H,
 
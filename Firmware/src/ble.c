@@ -10,6 +10,7 @@
 #include "ota.h"
 
 #include "ble.h"
+#include "ble_conn.h"
 #include "cmd_parser.h"
 #include "flash.h"
 
@@ -17,16 +18,28 @@ RAM uint8_t ble_connected = 0;
 RAM uint8_t ota_started = 0;
 extern uint8_t my_tempVal[2];
 extern uint8_t my_batVal[1];
-
-RAM uint8_t blt_rxfifo_b[64 * 8] = {0};
+extern uint8_t my_EPD_BLE_Data[3 + BLE_CONN_INFO_LEN];
+RAM uint32_t ble_dle_tick = 0; // connect time, until the data length exchange was started
+
+// Image uploads are writes without response from the central. With the 247 byte
+// MTU a 244 byte write is one 251 octet PDU: (251 + 14) * 8 us on air at 1M, with
+// the IFS and the empty ack 2.5 ms, 1.4 ms at 2M. A 7.5 ms interval fits 3 of them
+// at 1M (~97 KB/s) and 5 at 2M (~160 KB/s), a 4000 byte frame is 17 writes. With
+// 27 octet PDUs it was 20 bytes per 0.7 ms, ~27 KB/s at best and 200 writes.
+//
+// An RX entry has to hold a 251 octet PDU + 24, 16 aligned
+RAM uint8_t blt_rxfifo_b[288 * 8] = {0};
 RAM my_fifo_t blt_rxfifo = {
-	64,
+	288,
 	8,
 	0,
 	0,
 	blt_rxfifo_b,
 };
 
+// We only send notifications of up to 20 bytes, so TX stays at 27 octets and its
+// entries at 40 bytes. The LL splits anything longer, like a long read response
+#define BLE_LL_MAX_TX_OCTETS 27
 RAM uint8_t blt_txfifo_b[40 * 16] = {0};
 RAM my_fifo_t blt_txfifo = {
 	40,
@@ -71,13 +84,40 @@ _attribute_ram_code_ void ble_connect_callback(uint8_t e, uint8_t *p, int n)
 {
 	ble_connected = 1;
 	ota_started = 0;
-	ble_set_connection_speed(200);
+	ble_dle_tick = clock_time() | 1;
+	ble_conn_connected();
 	printf("BLE connected\r\n");
 }
 
-_attribute_ram_code_ void ble_set_connection_speed(uint16_t speed)
+_attribute_ram_code_ void ble_dle_callback(uint8_t e, uint8_t *p, int n)
 {
-	bls_l2cap_requestConnParamUpdate(speed, speed + 2, 0, 2000);
+	ble_dle_tick = 0; // the central already did it
+}
+
+// Asks for long LL PDUs a while after connecting, so it does not collide with
+// what the central does right after connecting, runs the connection parameter
+// policy and keeps what the EPD_BLE characteristic reads back up to date
+_attribute_ram_code_ void ble_link_handler(void)
+{
+	uint16_t payload, chunk;
+
+	if (!ble_connected)
+		return;
+	if (ble_dle_tick && clock_time_exceed(ble_dle_tick, 1500000))
+	{
+		ble_dle_tick = 0;
+		blc_ll_exchangeDataLength(LL_LENGTH_REQ, BLE_LL_MAX_TX_OCTETS);
+	}
+
+	// Largest write payload and the 0x0B chunk size that fits it
+	payload = blc_att_getEffectiveMtuSize(BLS_CONN_HANDLE) - 3;
+	chunk = payload - 5 > 255 ? 255 : payload - 5;
+	my_EPD_BLE_Data[0] = payload >> 8;
+	my_EPD_BLE_Data[1] = payload;
+	my_EPD_BLE_Data[2] = chunk;
+
+	ble_conn_handler();
+	ble_conn_info(&my_EPD_BLE_Data[3]);
 }
 
 _attribute_ram_code_ int otaWritePre(void *p)
@@ -85,7 +125,7 @@ _attribute_ram_code_ int otaWritePre(void *p)
 	if (ota_started == 0)
 	{
 		ota_started = 1;
-		ble_set_connection_speed(6);
+		ble_conn_phase(BLE_PHASE_OTA);
 	}
 	return custom_otaWrite(p);
 }
@@ -130,6 +170,7 @@ void init_ble(void)
 	blc_ll_initConnection_module();			   // connection module  must for BLE slave/master
 	blc_ll_initSlaveRole_module();			   // slave module: 	 must for BLE slave,
 	blc_ll_initPowerManagement_module();	   // pm module:      	 optional
+	ble_conn_init();						   // 2M PHY
 
 	////// Host Initialization  //////////
 	blc_gap_peripheral_init();
@@ -146,6 +187,7 @@ void init_ble(void)
 	bls_app_registerEventCallback(BLT_EV_FLAG_SUSPEND_EXIT, &user_set_rf_power);
 	bls_app_registerEventCallback(BLT_EV_FLAG_CONNECT, &ble_connect_callback);
 	bls_app_registerEventCallback(BLT_EV_FLAG_TERMINATE, &ble_disconnect_callback);
+	bls_app_registerEventCallback(BLT_EV_FLAG_DATA_LENGTH_EXCHANGE, &ble_dle_callback);
 
 	///////////////////// Power Management initialization///////////////////
 	blc_ll_initPowerManagement_module();
@@ -153,7 +195,7 @@ void init_ble(void)
 	blc_pm_setDeepsleepRetentionThreshold(95, 95);
 	blc_pm_setDeepsleepRetentionEarlyWakeupTiming(240);
 	blc_pm_setDeepsleepRetentionType(DEEPSLEEP_MODE_RET_SRAM_LOW32K);
-	blc_att_setRxMtuSize(250);
+	blc_att_setRxMtuSize(247); // with the 4 byte L2CAP header one write fills one 251 byte LL PDU
 }
 
 _attribute_ram_code_ bool ble_get_connected(void)
@@ -10,7 +10,7 @@ bool ble_get_ota_started(void);
 void ble_send_temp(int16_t temp);
 void ble_send_battery(uint8_t value);
 void blt_pm_proc(void);
+void ble_link_handler(void);
 
 int RxTxWrite(void *p);
 int otaWritePre(void *p);
-void ble_set_connection_speed(uint16_t speed);
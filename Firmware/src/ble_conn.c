@@ -0,0 +1,229 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "stack/ble/ble.h"
+#include "ble_conn.h"
+#include "epd.h"
+
+typedef struct
+{
+    uint16_t interval_min; // 1.25 ms units
+    uint16_t interval_max;
+    uint16_t latency;      // connection events the slave may skip
+    uint16_t timeout;      // 10 ms units
+} ble_conn_params_t;
+
+// Indexed by BLE_PHASE_*, the transfer interval is scaled by ble_conn_steps
+static const ble_conn_params_t ble_conn_table[] = {
+    {200, 202, 4, 2000}, // idle, nothing to do but answer now and then
+    {6, 8, 0, 400},      // transfer
+    {200, 202, 4, 2000}, // refresh, the EPD is busy for seconds
+    {6, 8, 0, 2000},     // ota
+};
+
+// Transfer intervals from fast to slow, taken slower when the central sends less
+// than one write every 4 connection events or rejects the interval
+static const uint8_t ble_conn_steps[] = {1, 2, 4, 7};
+
+#define BLE_CONN_TRANSFER_IDLE_MS 3000 // back to idle without writes for this long
+#define BLE_CONN_MEASURE_MS 1000
+
+// 2M PHY for transfers and OTA while the link is strong enough, with some
+// hysteresis so a label at the edge does not flip every second
+#define BLE_CONN_2M_MIN_RSSI -70
+#define BLE_CONN_1M_BELOW_RSSI -80
+
+RAM uint8_t ble_conn_cur = BLE_PHASE_IDLE;
+RAM uint8_t ble_conn_step = 0;
+RAM uint8_t ble_conn_rejected = 0; // the central refused the last request of this phase
+RAM uint16_t ble_conn_writes = 0;  // transfer writes in the current measurement
+RAM uint32_t ble_conn_measure_tick = 0;
+RAM uint32_t ble_conn_last_write = 0;
+RAM uint8_t ble_conn_phy = BLE_PHY_1M;      // in use, from the PHY update event
+RAM uint8_t ble_conn_phy_want = 0;         // last requested, 0 = none, only to not ask twice
+// Link statistics since boot: transfer writes per PHY and weak link fallbacks
+RAM uint16_t ble_conn_writes_1m = 0;
+RAM uint16_t ble_conn_writes_2m = 0;
+RAM uint8_t ble_conn_phy_fallbacks = 0;
+
+_attribute_ram_code_ static void ble_conn_request(void)
+{
+    const ble_conn_params_t *p = &ble_conn_table[ble_conn_cur];
+    uint8_t scale = ble_conn_cur == BLE_PHASE_TRANSFER ? ble_conn_steps[ble_conn_step] : 1;
+
+    bls_l2cap_requestConnParamUpdate(p->interval_min * scale, p->interval_max * scale, p->latency, p->timeout);
+}
+
+_attribute_ram_code_ static int ble_conn_update_rsp(u8 id, u16 result)
+{
+    if (result != CONN_PARAM_UPDATE_REJECT)
+        return 0;
+    // Some centrals only accept slower intervals, try the next transfer step once more
+    if (ble_conn_cur == BLE_PHASE_TRANSFER && !ble_conn_rejected && ble_conn_step < sizeof(ble_conn_steps) - 1)
+    {
+        ble_conn_step++;
+        ble_conn_request();
+    }
+    ble_conn_rejected = 1;
+    return 0;
+}
+
+_attribute_ram_code_ static int8_t ble_conn_rssi(void)
+{
+    return blc_ll_getLatestAvgRSSI() - 110;
+}
+
+// Returns 1 if a request went out
+_attribute_ram_code_ static uint8_t ble_conn_set_phy(uint8_t phy)
+{
+    if (phy == ble_conn_phy || phy == ble_conn_phy_want)
+        return 0;
+    ble_conn_phy_want = phy;
+    blc_ll_setPhy(BLS_CONN_HANDLE, PHY_TRX_PREFER, phy == BLE_PHY_2M ? PHY_PREFER_2M : PHY_PREFER_1M,
+                  phy == BLE_PHY_2M ? PHY_PREFER_2M : PHY_PREFER_1M, CODED_PHY_PREFER_NONE);
+    return 1;
+}
+
+// 2M while moving data over a good link, 1M otherwise. Decided on the PHY in
+// use, which the central may have switched to on its own
+_attribute_ram_code_ static void ble_conn_pick_phy(void)
+{
+    int8_t rssi = ble_conn_rssi();
+
+    if (ble_conn_cur != BLE_PHASE_TRANSFER && ble_conn_cur != BLE_PHASE_OTA)
+        ble_conn_set_phy(BLE_PHY_1M);
+    else if (ble_conn_phy == BLE_PHY_2M && rssi < BLE_CONN_1M_BELOW_RSSI)
+    {
+        if (ble_conn_set_phy(BLE_PHY_1M))
+            ble_conn_phy_fallbacks++;
+    }
+    else if (ble_conn_phy == BLE_PHY_1M && rssi >= BLE_CONN_2M_MIN_RSSI)
+        ble_conn_set_phy(BLE_PHY_2M);
+}
+
+_attribute_ram_code_ static void ble_conn_phy_callback(uint8_t e, uint8_t *p, int n)
+{
+    hci_le_readPhyCmd_retParam_t phy;
+
+    if (blc_ll_readPhy(BLS_CONN_HANDLE, &phy) != BLE_SUCCESS)
+        return;
+    // A switch the central made on its own voids the last request, so it can
+    // be asked for again. A refused request leaves the PHY and is not repeated
+    if (phy.tx_phy != ble_conn_phy && phy.tx_phy != ble_conn_phy_want)
+        ble_conn_phy_want = 0;
+    ble_conn_phy = phy.tx_phy;
+}
+
+// Advertising stays on 1M, a central may switch the connection to 2M
+void ble_conn_init(void)
+{
+    blc_ll_init2MPhyCodedPhy_feature();
+    blc_ll_setDefaultPhy(PHY_TRX_PREFER, PHY_PREFER_1M | PHY_PREFER_2M, PHY_PREFER_1M | PHY_PREFER_2M);
+    bls_app_registerEventCallback(BLT_EV_FLAG_PHY_UPDATE, &ble_conn_phy_callback);
+}
+
+_attribute_ram_code_ void ble_conn_connected(void)
+{
+    blc_l2cap_registerConnUpdateRspCb(ble_conn_update_rsp);
+    ble_conn_cur = BLE_PHASE_IDLE;
+    ble_conn_step = 0;
+    ble_conn_rejected = 0;
+    ble_conn_phy = BLE_PHY_1M;
+    ble_conn_phy_want = 0;
+    ble_conn_request();
+}
+
+// Called for every write that belongs to a phase, a new phase requests its parameters
+_attribute_ram_code_ void ble_conn_phase(uint8_t phase)
+{
+    if (phase == BLE_PHASE_TRANSFER)
+    {
+        ble_conn_writes++;
+        ble_conn_last_write = clock_time();
+        if (ble_conn_phy == BLE_PHY_2M)
+            ble_conn_writes_2m++;
+        else
+            ble_conn_writes_1m++;
+    }
+    // OTA keeps its parameters until the disconnect
+    if (phase == ble_conn_cur || ble_conn_cur == BLE_PHASE_OTA)
+        return;
+
+    ble_conn_cur = phase;
+    ble_conn_rejected = 0;
+    if (phase == BLE_PHASE_TRANSFER)
+    {
+        ble_conn_writes = 1;
+        ble_conn_measure_tick = clock_time();
+    }
+    ble_conn_request();
+    ble_conn_pick_phy();
+}
+
+_attribute_ram_code_ uint8_t ble_conn_current(void)
+{
+    return ble_conn_cur;
+}
+
+// Ends the transfer and refresh phases and adapts the transfer interval to
+// how fast the central really sends
+_attribute_ram_code_ void ble_conn_handler(void)
+{
+    uint32_t per_100_events;
+
+    if (ble_conn_cur == BLE_PHASE_REFRESH && !epd_update_running())
+    {
+        ble_conn_phase(BLE_PHASE_IDLE);
+        return;
+    }
+    if (ble_conn_cur != BLE_PHASE_TRANSFER)
+        return;
+    if (clock_time_exceed(ble_conn_last_write, BLE_CONN_TRANSFER_IDLE_MS * 1000))
+    {
+        ble_conn_phase(BLE_PHASE_IDLE);
+        return;
+    }
+    if (!clock_time_exceed(ble_conn_measure_tick, BLE_CONN_MEASURE_MS * 1000))
+        return;
+
+    // Writes per 100 connection events, the interval is in 1.25 ms units
+    ble_conn_pick_phy();
+
+    per_100_events = (uint32_t)ble_conn_writes * bls_ll_getConnectionInterval() * 125 / BLE_CONN_MEASURE_MS;
+    ble_conn_writes = 0;
+    ble_conn_measure_tick = clock_time();
+    if (per_100_events < 25 && ble_conn_step < sizeof(ble_conn_steps) - 1)
+    {
+        ble_conn_step++; // the sender is the bottleneck, save the radio time
+        ble_conn_request();
+    }
+    else if (per_100_events >= 200 && ble_conn_step && !ble_conn_rejected)
+    {
+        ble_conn_step--; // events are full, go faster
+        ble_conn_request();
+    }
+}
+
+// phase, interval hi, lo, latency hi, lo, timeout hi, lo as in use right now,
+// PHY, average RSSI in dBm, writes on 1M hi, lo, on 2M hi, lo and the fallbacks
+_attribute_ram_code_ void ble_conn_info(uint8_t *out)
+{
+    uint16_t interval = bls_ll_getConnectionInterval();
+    uint16_t latency = bls_ll_getConnectionLatency();
+    uint16_t timeout = bls_ll_getConnectionTimeout();
+
+    out[0] = ble_conn_cur;
+    out[1] = interval >> 8;
+    out[2] = interval;
+    out[3] = latency >> 8;
+    out[4] = latency;
+    out[5] = timeout >> 8;
+    out[6] = timeout;
+    out[7] = ble_conn_phy;
+    out[8] = ble_conn_rssi();
+    out[9] = ble_conn_writes_1m >> 8;
+    out[10] = ble_conn_writes_1m;
+    out[11] = ble_conn_writes_2m >> 8;
+    out[12] = ble_conn_writes_2m;
+    out[13] = ble_conn_phy_fallbacks;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+
+// What the connection is used for right now, each has its own parameters
+#define BLE_PHASE_IDLE 0
+#define BLE_PHASE_TRANSFER 1 // image data is coming in
+#define BLE_PHASE_REFRESH 2  // waiting for the EPD to finish
+#define BLE_PHASE_OTA 3
+
+// Bytes ble_conn_info writes
+#define BLE_CONN_INFO_LEN 14
+
+void ble_conn_init(void);
+void ble_conn_connected(void);
+void ble_conn_phase(uint8_t phase);
+uint8_t ble_conn_current(void);
+void ble_conn_handler(void);
+void ble_conn_info(uint8_t *out);
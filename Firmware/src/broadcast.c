@@ -0,0 +1,152 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "stack/ble/ble.h"
+
+#include "broadcast.h"
+#include "broadcast_frame.h"
+#include "epd.h"
+#include "epd_template.h"
+#include "flash.h"
+#include "time.h"
+
+extern settings_struct settings;
+extern uint8_t mac_public[6];
+
+RAM uint8_t broadcast_scanning = 0;
+RAM uint32_t broadcast_scan_tick = 0;
+RAM uint32_t broadcast_counter = 0; // newest accepted, older and repeated packets are dropped
+RAM uint32_t broadcast_mark = 0;    // no counter up to here is accepted after a reset
+RAM uint16_t broadcast_mark_pos = 0; // offset of the next erased word in the sector
+
+// The default key is all zero, which means none was provisioned
+_attribute_ram_code_ static uint8_t broadcast_key_set(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(settings.broadcast_key); i++)
+        if (settings.broadcast_key[i])
+            return 1;
+    return 0;
+}
+
+// The last written word of the sector is the mark
+static void broadcast_mark_load(void)
+{
+    uint32_t words[64];
+    uint16_t page, i;
+
+    for (page = 0; page < 0x1000; page += sizeof(words))
+    {
+        flash_read_page(BROADCAST_MARK_ADDR + page, sizeof(words), (uint8_t *)words);
+        for (i = 0; i < 64; i++)
+        {
+            if (words[i] == 0xffffffff)
+            {
+                broadcast_mark_pos = page + i * 4;
+                return;
+            }
+            broadcast_mark = words[i];
+        }
+    }
+    broadcast_mark_pos = 0x1000;
+}
+
+// Moves the mark ahead of counter before anything of its broadcast runs
+_attribute_ram_code_ static void broadcast_mark_update(uint32_t counter)
+{
+    if (counter < broadcast_mark)
+        return;
+    broadcast_mark = counter < 0xffffffff - BROADCAST_MARK_STEP ? counter + BROADCAST_MARK_STEP : 0xfffffffe;
+    if (broadcast_mark_pos >= 0x1000)
+    {
+        flash_erase_sector(BROADCAST_MARK_ADDR);
+        broadcast_mark_pos = 0;
+    }
+    flash_write_page(BROADCAST_MARK_ADDR + broadcast_mark_pos, 4, (uint8_t *)&broadcast_mark);
+    broadcast_mark_pos += 4;
+}
+
+_attribute_ram_code_ static void broadcast_run(const bcast_frame_t *f)
+{
+    const uint8_t *value;
+    uint8_t type, len;
+    int pos = 0;
+
+    while ((pos = bcast_cmd_next(f, pos, &type, &value, &len)))
+    {
+        switch (type)
+        {
+        case BCAST_CMD_SLOT:
+            if (len >= 1)
+                epd_display_slot(value[0], len >= 2 ? value[1] : 1);
+            break;
+        case BCAST_CMD_TIME:
+            if (len >= 4)
+                set_time(value[0] << 24 | value[1] << 16 | value[2] << 8 | value[3]);
+            break;
+        case BCAST_CMD_FIELD:
+            if (len >= 1)
+                epd_template_set_field(value[0], &value[1], len - 1);
+            break;
+        case BCAST_CMD_TEMPLATE:
+            if (len >= 1)
+                epd_display_template(value[0], len >= 2 ? value[1] : 1);
+            break;
+        }
+    }
+}
+
+_attribute_ram_code_ static int broadcast_event(u32 h, u8 *p, int n)
+{
+    event_adv_report_t *pa = (event_adv_report_t *)p;
+    const uint8_t *payload;
+    bcast_frame_t f;
+    int len;
+
+    if (!(h & HCI_FLAG_EVENT_BT_STD) || (h & 0xff) != HCI_EVT_LE_META || p[0] != HCI_SUB_EVT_LE_ADVERTISING_REPORT)
+        return 0;
+    if (!broadcast_key_set())
+        return 0;
+    if (pa->event_type != ADV_REPORT_EVENT_TYPE_NONCONN_IND)
+        return 0;
+    len = bcast_find(pa->data, pa->len, &payload);
+    if (!len || !bcast_parse(payload, len, settings.broadcast_key, aes_ecb_encryption, &f))
+        return 0;
+    if (!bcast_accept(&f, &broadcast_counter, mac_public, settings.groups, SETTINGS_GROUPS))
+        return 0;
+    broadcast_mark_update(f.counter);
+    broadcast_run(&f);
+    return 0;
+}
+
+void init_broadcast(void)
+{
+    broadcast_mark_load();
+    broadcast_counter = broadcast_mark;
+    blc_ll_initScanning_module(mac_public);
+    blc_ll_setScanParameter(SCAN_TYPE_PASSIVE, SCAN_INTERVAL_100MS, SCAN_INTERVAL_100MS, OWN_ADDRESS_PUBLIC, SCAN_FP_ALLOW_ADV_ANY);
+    blc_hci_le_setEventMask_cmd(hci_le_eventMask | HCI_LE_EVT_MASK_ADVERTISING_REPORT);
+    blc_hci_registerControllerEventHandler(broadcast_event);
+}
+
+// Opens and closes the scan windows, returns 1 while one is open as scanning
+// only happens while the MCU stays awake between the advertising events
+_attribute_ram_code_ uint8_t broadcast_handler(void)
+{
+    if (broadcast_scanning)
+    {
+        if (ble_get_connected() || clock_time_exceed(broadcast_scan_tick, BROADCAST_WINDOW_MS * 1000))
+        {
+            blc_ll_removeScanningFromAdvState();
+            broadcast_scanning = 0;
+        }
+    }
+    else if (settings.broadcast_period && broadcast_key_set() && !ble_get_connected() && time_reached_period(Timer_CH_0, settings.broadcast_period))
+    {
+        blc_ll_addScanningInAdvState();
+        broadcast_scan_tick = clock_time();
+        broadcast_scanning = 1;
+    }
+    return broadcast_scanning;
+}
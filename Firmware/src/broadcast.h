@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+// Opt-in listening for signed broadcasts while not connected, see broadcast_frame.h.
+// Every settings.broadcast_period seconds the advertising gaps are scanned for
+// BROADCAST_WINDOW_MS, a transmitter repeats its packet for at least one period
+#define BROADCAST_WINDOW_MS 1500
+
+// Counters up to a mark kept in its own sector behind the templates are refused
+// after a reset. Each mark is written BROADCAST_MARK_STEP ahead of the counter
+// into the next erased word of the sector, so there is one flash write per
+// BROADCAST_MARK_STEP broadcasts and one erase per 1024 writes
+#define BROADCAST_MARK_ADDR 0x7E000
+#define BROADCAST_MARK_STEP 256
+
+void init_broadcast(void);
+uint8_t broadcast_handler(void);
@@ -0,0 +1,101 @@
+#include <stdint.h>
+#include <string.h>
+#include "broadcast_frame.h"
+
+// Plain C without SDK dependencies so it also builds on the host
+
+// Returns the length of our manufacturer data in the advertising data, 0 if there is none
+int bcast_find(const uint8_t *adv, int len, const uint8_t **payload)
+{
+    int pos = 0;
+
+    while (pos + 1 < len && adv[pos])
+    {
+        uint8_t ad_len = adv[pos];
+        if (pos + 1 + ad_len > len)
+            break;
+        if (ad_len > 3 && adv[pos + 1] == 0xFF && adv[pos + 2] == (BCAST_COMPANY_ID & 0xff) && adv[pos + 3] == (BCAST_COMPANY_ID >> 8))
+        {
+            *payload = &adv[pos + 4];
+            return ad_len - 3;
+        }
+        pos += 1 + ad_len;
+    }
+    return 0;
+}
+
+static void bcast_cbc_mac(const uint8_t *data, int len, uint8_t *key, bcast_aes_t aes, uint8_t *mac)
+{
+    uint8_t block[16];
+    int pos = -1, i;
+
+    // The length goes first so frames of different length never share a chain
+    memset(mac, 0, 16);
+    while (pos < len)
+    {
+        for (i = 0; i < 16; i++, pos++)
+            mac[i] ^= pos < 0 ? len : (pos < len ? data[pos] : 0);
+        aes(key, mac, block);
+        memcpy(mac, block, 16);
+    }
+}
+
+// Checks version and tag, returns 0 for anything not meant for a receiver with key
+uint8_t bcast_parse(const uint8_t *payload, int len, uint8_t *key, bcast_aes_t aes, bcast_frame_t *f)
+{
+    uint8_t mac[16];
+
+    if (len < BCAST_HEADER_LEN + BCAST_TAG_LEN || len > BCAST_MAX_LEN || payload[0] != BCAST_VERSION)
+        return 0;
+    bcast_cbc_mac(payload, len - BCAST_TAG_LEN, key, aes, mac);
+    if (memcmp(mac, &payload[len - BCAST_TAG_LEN], BCAST_TAG_LEN))
+        return 0;
+
+    f->counter = (uint32_t)payload[1] << 24 | payload[2] << 16 | payload[3] << 8 | payload[4];
+    f->target = payload[5];
+    memcpy(f->addr, &payload[6], 3);
+    f->cmds = &payload[BCAST_HEADER_LEN];
+    f->cmds_len = len - BCAST_HEADER_LEN - BCAST_TAG_LEN;
+    return 1;
+}
+
+// mac as from blc_initMacAddress, mac[0] is the last byte. Group 0 is never a member
+uint8_t bcast_addressed(const bcast_frame_t *f, const uint8_t *mac, const uint16_t *groups, int group_count)
+{
+    uint16_t group = f->addr[0] << 8 | f->addr[1];
+    int i;
+
+    if (f->target == BCAST_TARGET_ALL)
+        return 1;
+    if (f->target == BCAST_TARGET_MAC)
+        return f->addr[0] == mac[2] && f->addr[1] == mac[1] && f->addr[2] == mac[0];
+    if (f->target == BCAST_TARGET_GROUP && group)
+    {
+        for (i = 0; i < group_count; i++)
+            if (groups[i] == group)
+                return 1;
+    }
+    return 0;
+}
+
+// A frame addressed to this label with a counter above *counter, which then
+// moves to it. Frames for other labels leave it, their counters say nothing
+// about the ones still coming for this label
+uint8_t bcast_accept(const bcast_frame_t *f, uint32_t *counter, const uint8_t *mac, const uint16_t *groups, int group_count)
+{
+    if (!bcast_addressed(f, mac, groups, group_count) || f->counter <= *counter)
+        return 0;
+    *counter = f->counter;
+    return 1;
+}
+
+// Returns the position of the next command, 0 once there is none or it is cut off
+int bcast_cmd_next(const bcast_frame_t *f, int pos, uint8_t *type, const uint8_t **value, uint8_t *len)
+{
+    if (pos + 2 > f->cmds_len || pos + 2 + f->cmds[pos + 1] > f->cmds_len)
+        return 0;
+    *type = f->cmds[pos];
+    *len = f->cmds[pos + 1];
+    *value = &f->cmds[pos + 2];
+    return pos + 2 + *len;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+// Signed commands in the manufacturer data of a legacy advertising packet,
+// see broadcast.py for the host side:
+//   0xFF company_lo company_hi version counter[4] target addr[3] commands tag[4]
+// counter is big endian. A label only takes a counter above the last one of a
+// broadcast addressed to it, so counters have to grow from one broadcast to the
+// next for each label, over its whole life: a reset skips up to
+// BROADCAST_MARK_STEP counters. One transmitter going through many labels can
+// count up over all of them, the unix time in seconds makes a good counter. target
+// BCAST_TARGET_MAC matches the last three MAC bytes as in the name, mac[2]
+// first, BCAST_TARGET_GROUP a group id in the first two addr bytes, see
+// settings.groups. The commands are TLV8 (type, len, value). The tag is the first
+// four bytes of an AES-128 CBC-MAC over length, version ... commands, zero padded
+#define BCAST_COMPANY_ID 0xFFFF
+#define BCAST_VERSION 1
+#define BCAST_TAG_LEN 4
+#define BCAST_HEADER_LEN 9 // version, counter, target, addr
+#define BCAST_MAX_LEN 27   // what 31 bytes of advertising data leave
+
+#define BCAST_TARGET_ALL 0
+#define BCAST_TARGET_MAC 1
+#define BCAST_TARGET_GROUP 2
+
+#define BCAST_CMD_SLOT 0x01 // slot [full_or_partial], see epd_slot.h
+#define BCAST_CMD_TIME 0x02 // unix time[4], big endian
+#define BCAST_CMD_FIELD 0x03 // field text, see epd_template.h
+#define BCAST_CMD_TEMPLATE 0x04 // template [full_or_partial]
+
+typedef void (*bcast_aes_t)(uint8_t *key, uint8_t *plain, uint8_t *result);
+
+typedef struct
+{
+    uint32_t counter;
+    uint8_t target;
+    uint8_t addr[3];
+    const uint8_t *cmds;
+    uint8_t cmds_len;
+} bcast_frame_t;
+
+int bcast_find(const uint8_t *adv, int len, const uint8_t **payload);
+uint8_t bcast_parse(const uint8_t *payload, int len, uint8_t *key, bcast_aes_t aes, bcast_frame_t *f);
+uint8_t bcast_addressed(const bcast_frame_t *f, const uint8_t *mac, const uint16_t *groups, int group_count);
+uint8_t bcast_accept(const bcast_frame_t *f, uint32_t *counter, const uint8_t *mac, const uint16_t *groups, int group_count);
+int bcast_cmd_next(const bcast_frame_t *f, int pos, uint8_t *type, const uint8_t **value, uint8_t *len);
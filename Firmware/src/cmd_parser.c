@@ -7,13 +7,29 @@
 
 #include "time.h"
 #include "flash.h"
+#include "epd_template.h"
 
 extern settings_struct settings;
 
 #define testPin GPIO_PD3
-void cmd_parser(void * p){
-	rf_packet_att_data_t *req = (rf_packet_att_data_t*)p;
-	uint8_t inData = req->dat[0];
+
+// Batched commands: 0xBA group_hi group_lo, then every command as TLV8 with
+// its opcode as type and the bytes that follow it as value. Applied in order
+// if group is 0 or one of settings.groups
+#define CMD_BATCH 0xBA
+
+_attribute_ram_code_ uint8_t cmd_in_group(uint16_t group)
+{
+	uint8_t i;
+
+	if(group == 0)return 1;
+	for(i = 0; i < SETTINGS_GROUPS; i++)
+		if(settings.groups[i] == group)return 1;
+	return 0;
+}
+
+static void cmd_run(uint8_t *dat){
+	uint8_t inData = dat[0];
 	if(inData == 0xFF){
 	gpio_set_func(testPin, AS_GPIO);
 	gpio_set_output_en(testPin, 1);
@@ -29,7 +45,7 @@ void cmd_parser(void * p){
 	}else if(inData == 0x0C){
 		settings.advertising_temp_C_or_F = false;//Advertising Temp in C
 	}else if(inData == 0xB1){
-		epd_display_char(req->dat[1]);
+		epd_display_char(dat[1]);
 	}else if(inData == 0xB0){
 		settings.show_batt_enabled = false;//Disable battery on LCD
 	}else if(inData == 0xA0){
@@ -47,14 +63,14 @@ void cmd_parser(void * p){
 	}else if(inData == 0xAB){
 		settings.blinking_smiley = true;//Smiley blinking
 	}else if(inData == 0xFE){
-		settings.advertising_interval = req->dat[1];//Set advertising interval with second byte, value*10second / 0=main_delay
+		settings.advertising_interval = dat[1];//Set advertising interval with second byte, value*10second / 0=main_delay
 	}else if(inData == 0xFA){
-		settings.temp_offset = req->dat[1];//Set temp offset, -12,5 - +12,5 °C
+		settings.temp_offset = dat[1];//Set temp offset, -12,5 - +12,5 °C
 	}else if(inData == 0xFC){
-		settings.temp_alarm_point = req->dat[1];//Set temp alarm point value divided by 10 for temp in °C
+		settings.temp_alarm_point = dat[1];//Set temp alarm point value divided by 10 for temp in °C
 		if(settings.temp_alarm_point==0)settings.temp_alarm_point = 1;
 	}else if(inData == 0xDD){// Set time
-		uint32_t new_time = (req->dat[1]<<24) +(req->dat[2]<<16) +(req->dat[3]<<8) +(req->dat[4]&0xff);
+		uint32_t new_time = (dat[1]<<24) +(dat[2]<<16) +(dat[3]<<8) +(dat[4]&0xff);
 		set_time(new_time);
 	}else if(inData == 0xDE){// Save settings in flash to default
 		reset_settings_to_default();
@@ -63,6 +79,52 @@ void cmd_parser(void * p){
 		save_settings_to_flash();
 	}
 	else if(inData == 0xE0){// force set an EPD model, if it wasnt detect automatically correct
-		set_EPD_model(req->dat[1]);
+		set_EPD_model(dat[1]);
+	}else if(inData == 0xE1){// Set the 16 byte key broadcasts are signed with, all zero = none and no broadcast is taken
+		memcpy(settings.broadcast_key, &dat[1], sizeof(settings.broadcast_key));
+	}else if(inData == 0xE2){// Scan for broadcasts every second+third byte seconds, 0 = off
+		settings.broadcast_period = (dat[1]<<8) | dat[2];
+	}else if(inData == 0xE3){// Show flash slot second byte, third byte full_or_partial, 0 = partial
+		epd_display_slot(dat[1], dat[2]);
+	}else if(inData == 0xE4){// Set group second byte (0-3) to third+fourth byte, 0 = none
+		if(dat[1] < SETTINGS_GROUPS)settings.groups[dat[1]] = (dat[2]<<8) | dat[3];
+	}else if(inData == 0xE5){// Set template field second byte to the text that follows
+		epd_template_set_field(dat[1], &dat[2], strlen((char *)&dat[2]));
+	}else if(inData == 0xE6){// Show template second byte, third byte full_or_partial, 0 = partial
+		epd_display_template(dat[1], dat[2]);
+	}
+}
+
+// Walked here like bcast_cmd_next and not with the Mijia tlv8_decode: its
+// length is a uint8_t that wraps for values of 254 and 255 bytes, it looks for
+// a type rather than taking the next TLV and it reads the type one past the end
+_attribute_ram_code_ static void cmd_batch(const uint8_t *dat, int len){
+	uint8_t cmd[1 + 255];
+	int pos = 3;
+
+	if(len < 3 || !cmd_in_group((dat[1]<<8) | dat[2]))return;
+	while(pos + 2 <= len && pos + 2 + dat[pos + 1] <= len){
+		// Zero padded so a short value reads as zeros, not as the next command
+		memset(cmd, 0, sizeof(cmd));
+		cmd[0] = dat[pos];
+		memcpy(&cmd[1], &dat[pos + 2], dat[pos + 1]);
+		if(cmd[0] != CMD_BATCH)cmd_run(cmd);
+		pos += 2 + dat[pos + 1];
+	}
+}
+
+void cmd_parser(void * p){
+	rf_packet_att_data_t *req = (rf_packet_att_data_t*)p;
+	int len = req->l2cap - 3;
+	uint8_t cmd[1 + 255];
+
+	if(len < 1 || len >= sizeof(cmd))return;
+	if(req->dat[0] == CMD_BATCH){
+		cmd_batch(req->dat, len);
+		return;
 	}
+	// Zero padded like a batched command, so texts end where the write ends
+	memset(cmd, 0, sizeof(cmd));
+	memcpy(cmd, req->dat, len);
+	cmd_run(cmd);
 }
@@ -1,3 +1,4 @@
 #pragma once 
 
 void cmd_parser(void * p);
+uint8_t cmd_in_group(uint16_t group);
@@ -3,45 +3,109 @@
 #include "main.h"
 #include "epd.h"
 #include "epd_spi.h"
-#include "epd_bw_213.h"
-#include "epd_bwr_213.h"
-#include "epd_bw_213_ice.h"
-#include "epd_bwr_154.h"
+#include "epd_diff.h"
+#include "epd_driver.h"
+#include "epd_plane.h"
+#include "epd_rotate.h"
+#include "epd_slot.h"
+#include "epd_template.h"
 #include "drivers.h"
 #include "stack/ble/ble.h"
 
 #include "battery.h"
+#include "flash.h"
 
 #include "OneBitDisplay.h"
 #include "TIFF_G4.h"
-extern const uint8_t ucMirror[];
-#include "Roboto_Black_80.h"
-#include "font_60.h"
+// The RLE fonts come from "make fonts", see fontc.py
 #include "font16.h"
-#include "font30.h"
+#include "font30_rle.h"
+#include "font_60_rle.h"
+#include "font_80_price.h"
 
-RAM uint8_t epd_model = 0; // 0 = Undetected, 1 = BW213, 2 = BWR213, 3 = BWR154, 4 = BW213ICE
-const char *epd_model_string[] = {"NC", "BW213", "BWR213", "BWR154", "213ICE"};
+RAM uint8_t epd_model = 0; // 0 = Undetected, else the index in epd_drivers
 RAM uint8_t epd_update_state = 0;
+// SSD16xx panels keep their RAM in deep sleep mode 1, as long as we leave
+// them powered the next update only needs to send the changed windows
+RAM uint8_t epd_ram_valid = 0;
+// epd_model came from the settings instead of a probe, dropped again if the panel does not answer as expected
+RAM uint8_t epd_model_cached = 0;
 
 const char *BLE_conn_string[] = {"", "B"};
+
+// Fonts templates can use, Roboto_Black_80_price only has FONT_CHARS of the makefile
+const GFXfont *const epd_fonts[] = {
+    &Dialog_plain_16,
+    &Special_Elite_Regular_30_rle,
+    &DSEG14_Classic_Mini_Regular_40_rle,
+    &Roboto_Black_80_price,
+};
+const uint8_t epd_font_count = sizeof(epd_fonts) / sizeof(epd_fonts[0]);
 RAM uint8_t epd_temperature_is_read = 0;
 RAM uint8_t epd_temperature = 0;
 
 uint8_t epd_buffer[epd_buffer_size];
-uint8_t epd_temp[epd_buffer_size]; // for OneBitDisplay to draw into
 OBDISP obd;                        // virtual display structure
 TIFFIMAGE tiff;
 
-// With this we can force a display if it wasnt detected correctly
+extern settings_struct settings;
+
+static uint8_t epd_decode_tiff(uint8_t *pData, int iSize);
+
+// Only written when something changed, the probe result is the same on every boot
+static void epd_model_store(void)
+{
+    uint16_t width = 0, height = 0, fingerprint = 0;
+
+    if (epd_model)
+    {
+        width = epd_drivers[epd_model]->width;
+        height = epd_drivers[epd_model]->height;
+        fingerprint = epd_driver_fingerprint(epd_drivers[epd_model]);
+    }
+    if (settings.epd_model == epd_model && settings.epd_panel_w == width && settings.epd_panel_h == height && settings.epd_fingerprint == fingerprint)
+        return;
+
+    settings.epd_model = epd_model;
+    settings.epd_panel_w = width;
+    settings.epd_panel_h = height;
+    settings.epd_fingerprint = fingerprint;
+    save_settings_to_flash();
+}
+
+// The stored model is only used while its driver still has the same geometry and init sequence
+static uint8_t epd_model_load(void)
+{
+    const epd_driver_t *drv;
+
+    if (!settings.epd_model || settings.epd_model >= epd_drivers_count)
+        return 0;
+    drv = epd_drivers[settings.epd_model];
+    if (settings.epd_panel_w != drv->width || settings.epd_panel_h != drv->height || settings.epd_fingerprint != epd_driver_fingerprint(drv))
+        return 0;
+
+    epd_model = settings.epd_model;
+    epd_model_cached = 1;
+    return 1;
+}
+
+// With this we can force a display if it wasnt detected correctly, 0 probes again
 void set_EPD_model(uint8_t model_nr)
 {
+    if (model_nr >= epd_drivers_count)
+        model_nr = 0;
     epd_model = model_nr;
+    epd_model_cached = 0;
+    epd_ram_valid = 0;
+    epd_model_store();
 }
 
-// Here we detect what E-Paper display is connected
+// Here we detect what E-Paper display is connected, the probe only runs if no model is stored
 _attribute_ram_code_ void EPD_detect_model(void)
 {
+    if (epd_model_load())
+        return;
+
     EPD_init();
     // system power
     EPD_POWER_ON();
@@ -53,181 +117,524 @@ _attribute_ram_code_ void EPD_detect_model(void)
     gpio_write(EPD_RESET, 1);
     WaitMs(10);
 
-    // Here we neeed to detect it
-    if (EPD_BWR_213_detect())
+    // Here we neeed to detect it, the BWR154 will never trigger right now as it answers like the BWR213
+    // Whatever answers none of the probes is taken for the UC8151 BW213
+    uint8_t i;
+    epd_model = EPD_MODEL_FALLBACK;
+    for (i = 1; i < epd_drivers_count; i++)
     {
-        epd_model = 2;
+        if (epd_drivers[i]->detect && epd_drivers[i]->detect())
+        {
+            epd_model = i;
+            break;
+        }
     }
-    else if (EPD_BWR_154_detect())// Right now this will never trigger, the 154 is same to 213BWR right now.
+
+    EPD_POWER_OFF();
+    epd_model_store();
+}
+
+// Update states, the driver sequence runs in EPD_STATE_DRIVER
+#define EPD_STATE_IDLE 0
+#define EPD_STATE_POWER_ON 1
+#define EPD_STATE_RESET_LOW 2
+#define EPD_STATE_RESET_HIGH 3
+#define EPD_STATE_DRIVER 4
+#define EPD_STATE_REFRESH 5
+
+#define EPD_REFRESH_TIMEOUT_MS 40000
+
+epd_job_t epd_job;
+epd_job_t epd_job_next; // queued while an update is running
+uint8_t epd_job_next_valid = 0;
+uint32_t epd_wait_start = 0;
+uint32_t epd_wait_ticks = 0;
+uint8_t epd_wait_idle = 0;
+uint8_t epd_wait_timeout = 0;
+uint8_t epd_model_suspect = 0; // a cached model timed out during init
+uint8_t epd_job_failed = 0;    // a BUSY wait of the running job timed out
+
+_attribute_ram_code_ static uint8_t epd_is_idle(void)
+{
+    return (gpio_read(EPD_BUSY) ? 1 : 0) != epd_drivers[epd_model]->busy_level;
+}
+
+_attribute_ram_code_ static void epd_wait(uint16_t wait)
+{
+    epd_wait_start = clock_time();
+    epd_wait_ticks = (wait & 0x3fff) * CLOCK_16M_SYS_TIMER_CLK_1MS;
+    epd_wait_idle = (wait & 0x8000) ? 1 : 0;
+    epd_wait_timeout = 0;
+}
+
+// Fixed delays end at their deadline, BUSY waits when the panel is idle or at the timeout.
+// The BUSY pin is not trusted during the first ms, the controller needs a moment to raise it
+_attribute_ram_code_ static uint8_t epd_wait_done(void)
+{
+    uint32_t elapsed = clock_time() - epd_wait_start;
+    if (elapsed >= epd_wait_ticks)
     {
-        epd_model = 3;
+        epd_wait_timeout = epd_wait_idle;
+        return 1;
     }
-    else if (EPD_BW_213_ice_detect())
+    if (epd_wait_idle && elapsed >= CLOCK_16M_SYS_TIMER_CLK_1MS)
+        return epd_is_idle();
+    return 0;
+}
+
+_attribute_ram_code_ static uint16_t epd_driver_step(void)
+{
+    const epd_driver_t *drv = epd_drivers[epd_model];
+    const uint8_t *seq = drv->init;
+    uint16_t wait;
+
+    if (epd_wait_timeout && !epd_job.phase && epd_model_cached)
+        epd_model_suspect = 1;
+
+    if (epd_job.phase)
     {
-        epd_model = 4;
+        if (epd_job.kind == EPD_JOB_TEMP)
+            seq = drv->temp;
+        else if (epd_job.kind == EPD_JOB_WINDOW)
+            seq = drv->window;
+        else
+            seq = drv->display;
     }
-    else
+
+    wait = epd_seq_run(drv, seq, &epd_job.pos, &epd_job);
+    if (wait == EPD_STEP_DONE && !epd_job.phase)
     {
-        epd_model = 1;
+        epd_job.phase = 1;
+        epd_job.pos = 0;
+        return EPD_STEP_WAIT_MS(0);
     }
-
-    EPD_POWER_OFF();
+    return wait;
 }
 
-_attribute_ram_code_ int8_t EPD_read_temp(void)
+// Decides what the queued job really needs and starts it, returns 0 if there is nothing to send
+_attribute_ram_code_ static uint8_t epd_job_start(const epd_job_t *job)
 {
-    if (epd_temperature_is_read)
-        return epd_temperature;
-
     if (!epd_model)
         EPD_detect_model();
 
-    EPD_init();
-    // system power
-    EPD_POWER_ON();
-    WaitMs(5);
-    // Reset the EPD driver IC
-    gpio_write(EPD_RESET, 0);
-    WaitMs(10);
-    gpio_write(EPD_RESET, 1);
-    WaitMs(10);
+    epd_job = *job;
+    epd_job.phase = 0;
+    epd_job.pos = 0;
 
-    if (epd_model == 1)
-        epd_temperature = EPD_BW_213_read_temp();
-    else if (epd_model == 2)
-        epd_temperature = EPD_BWR_213_read_temp();
-    else if (epd_model == 3)
-        epd_temperature = EPD_BWR_154_read_temp();
-    else if (epd_model == 4)
-        epd_temperature = EPD_BW_213_ice_read_temp();
+    // Panels without RAM windows can not take it in strips, decode the whole frame first
+    if (epd_job.kind == EPD_JOB_TIFF && !epd_drivers[epd_model]->window)
+    {
+        if (!epd_decode_tiff(epd_job.image, epd_job.size))
+            return 0;
+        epd_job.kind = EPD_JOB_DISPLAY;
+        epd_job.size = EPD_FRAME_BYTES(epd_drivers[epd_model]);
+        epd_job.image = epd_buffer;
+    }
 
-    EPD_POWER_OFF();
+    // Windows only carry the black plane, a changed accent plane needs the whole frame
+    uint8_t windows_ok = epd_ram_valid && !(epd_accent_dirty && epd_drivers[epd_model]->planes > 1);
 
+    // The diff tiles are laid out for a frame as big as epd_buffer
+    if (epd_job.kind == EPD_JOB_DISPLAY && !epd_job.full_or_partial && windows_ok && epd_job.size == epd_buffer_size)
+    {
+        // Partial refresh of a panel that still holds the last frame, only send what changed
+        epd_job.win_count = epd_diff_find(epd_job.image, epd_job.win, EPD_DIFF_MAX_RECTS);
+        if (!epd_job.win_count)
+            return 0;
+        epd_job.kind = EPD_JOB_WINDOW;
+    }
+    else if (epd_job.kind == EPD_JOB_WINDOW && !windows_ok)
+    {
+        epd_job.kind = EPD_JOB_DISPLAY;
+        epd_job.size = EPD_FRAME_BYTES(epd_drivers[epd_model]);
+        epd_job.full_or_partial = 0;
+    }
+
+    epd_job_failed = 0;
+    epd_update_state = EPD_STATE_POWER_ON;
+    epd_wait(EPD_STEP_WAIT_MS(0));
+    return 1;
+}
+
+_attribute_ram_code_ static void epd_job_queue(const epd_job_t *job)
+{
+    if (epd_update_state)
+    {
+        // A queued full frame already covers any window of the same image
+        if (epd_job_next_valid && epd_job_next.kind == EPD_JOB_DISPLAY && job->kind == EPD_JOB_WINDOW && epd_job_next.image == job->image)
+            return;
+        // Otherwise the newest request replaces an older queued one
+        epd_job_next = *job;
+        epd_job_next_valid = 1;
+        return;
+    }
+    epd_job_start(job);
+}
+
+// The driver sequence is done, for a display job the refresh is running now
+_attribute_ram_code_ static void epd_job_loaded(void)
+{
+    epd_temperature = epd_job.temperature;
     epd_temperature_is_read = 1;
 
+    if (epd_job.kind == EPD_JOB_TEMP)
+    {
+        if (!epd_ram_valid)
+            EPD_POWER_OFF();
+        epd_update_state = EPD_STATE_IDLE;
+        return;
+    }
+
+    epd_update_state = EPD_STATE_REFRESH;
+    epd_wait(EPD_STEP_WAIT_IDLE(0));
+    epd_wait_ticks = EPD_REFRESH_TIMEOUT_MS * CLOCK_16M_SYS_TIMER_CLK_1MS;
+}
+
+// The refresh is over, what the panel holds now is only known if nothing timed out
+_attribute_ram_code_ static void epd_job_done(void)
+{
+    uint8_t i;
+
+    if (epd_job_failed)
+    {
+        epd_ram_valid = 0;
+        epd_diff_invalidate();
+        return;
+    }
+    if (epd_job.kind == EPD_JOB_DISPLAY || epd_job.kind == EPD_JOB_TIFF || epd_job.kind == EPD_JOB_SLOT)
+    {
+        // A streamed TIFF or slot never was in epd_buffer, so there is nothing to diff against
+        epd_ram_valid = (epd_job.kind == EPD_JOB_DISPLAY) && (epd_job.size == epd_buffer_size) && epd_drivers[epd_model]->window;
+        if (epd_drivers[epd_model]->planes > 1)
+            epd_accent_dirty = 0;
+    }
+    // A window only changed what it covers on the panel, also one pushed by the
+    // host with more changed in epd_buffer around it
+    if (epd_ram_valid && epd_job.kind == EPD_JOB_WINDOW)
+    {
+        for (i = 0; i < epd_job.win_count; i++)
+            epd_diff_store_window(epd_job.image, &epd_job.win[i]);
+    }
+    else if (epd_ram_valid)
+    {
+        epd_diff_store(epd_job.image);
+    }
+}
+
+_attribute_ram_code_ static void epd_step(void)
+{
+    uint16_t wait;
+
+    if (epd_wait_timeout)
+        epd_job_failed = 1;
+    switch (epd_update_state)
+    {
+    case EPD_STATE_POWER_ON:
+        EPD_init();
+        // system power
+        EPD_POWER_ON();
+        epd_update_state = EPD_STATE_RESET_LOW;
+        epd_wait(EPD_STEP_WAIT_MS(5));
+        break;
+    case EPD_STATE_RESET_LOW:
+        // Reset the EPD driver IC
+        gpio_write(EPD_RESET, 0);
+        epd_update_state = EPD_STATE_RESET_HIGH;
+        epd_wait(EPD_STEP_WAIT_MS(10));
+        break;
+    case EPD_STATE_RESET_HIGH:
+        gpio_write(EPD_RESET, 1);
+        epd_update_state = EPD_STATE_DRIVER;
+        epd_wait(EPD_STEP_WAIT_MS(10));
+        break;
+    case EPD_STATE_DRIVER:
+        wait = epd_driver_step();
+        if (wait == EPD_STEP_DONE)
+            epd_job_loaded();
+        else
+            epd_wait(wait);
+        break;
+    case EPD_STATE_REFRESH: // refresh is done or timed out, sleep epd
+        epd_job_done();
+        epd_set_sleep();
+        break;
+    }
+
+    // The stored model did not answer like that panel, probe again with the next update
+    if (!epd_update_state && epd_model_suspect)
+    {
+        epd_model_suspect = 0;
+        set_EPD_model(0);
+    }
+    if (!epd_update_state && epd_job_next_valid)
+    {
+        epd_job_next_valid = 0;
+        epd_job_start(&epd_job_next);
+    }
+    if (!epd_update_state)
+    {
+        cpu_set_gpio_wakeup(EPD_BUSY, 0, 0);
+        bls_pm_setAppWakeupLowPower(0, 0);
+    }
+}
+
+// Returns the last read temperature, a new read runs in the background if there is none yet
+_attribute_ram_code_ int8_t EPD_read_temp(void)
+{
+    if (!epd_temperature_is_read && !epd_update_state)
+    {
+        epd_job_t job = {0};
+        job.kind = EPD_JOB_TEMP;
+        epd_job_start(&job);
+    }
     return epd_temperature;
 }
 
 _attribute_ram_code_ void EPD_Display(unsigned char *image, int size, uint8_t full_or_partial)
 {
-    if (!epd_model)
-        EPD_detect_model();
-
-    EPD_init();
-    // system power
-    EPD_POWER_ON();
-    WaitMs(5);
-    // Reset the EPD driver IC
-    gpio_write(EPD_RESET, 0);
-    WaitMs(10);
-    gpio_write(EPD_RESET, 1);
-    WaitMs(10);
+    epd_job_t job = {0};
+    job.kind = EPD_JOB_DISPLAY;
+    job.image = image;
+    job.size = size;
+    job.full_or_partial = full_or_partial;
+    epd_job_queue(&job);
+}
 
-    if (epd_model == 1)
-        epd_temperature = EPD_BW_213_Display(image, size, full_or_partial);
-    else if (epd_model == 2)
-        epd_temperature = EPD_BWR_213_Display(image, size, full_or_partial);
-    else if (epd_model == 3)
-        epd_temperature = EPD_BWR_154_Display(image, size, full_or_partial);
-    else if (epd_model == 4)
-        epd_temperature = EPD_BW_213_ice_Display(image, size, full_or_partial);
+// Refresh with the partial LUT, only the bytes inside the windows are sent.
+// Falls back to a partial refresh of the whole frame if the panel can not do
+// windows or its RAM does not hold the last frame anymore. image is laid out
+// in lines of the panel, windows outside of it are dropped
+_attribute_ram_code_ void EPD_Display_window(unsigned char *image, const epd_window_t *win, uint8_t count)
+{
+    const epd_driver_t *drv;
+    epd_job_t job = {0};
+    uint8_t i;
 
-    epd_temperature_is_read = 1;
-    epd_update_state = 1;
+    if (!epd_model)
+        EPD_detect_model();
+    drv = epd_drivers[epd_model];
+    job.kind = EPD_JOB_WINDOW;
+    job.image = image;
+    for (i = 0; i < count && job.win_count < EPD_MAX_WINDOWS; i++)
+    {
+        if (win[i].w && win[i].h && win[i].x + win[i].w <= EPD_LINE_BYTES(drv) && win[i].y + win[i].h <= drv->width)
+            job.win[job.win_count++] = win[i];
+    }
+    if (job.win_count)
+        epd_job_queue(&job);
 }
 
 _attribute_ram_code_ void epd_set_sleep(void)
 {
+    uint16_t pos = 0;
+
     if (!epd_model)
         EPD_detect_model();
 
-    if (epd_model == 1)
-        EPD_BW_213_set_sleep();
-    else if (epd_model == 2)
-        EPD_BWR_213_set_sleep();
-    else if (epd_model == 3)
-        EPD_BWR_154_set_sleep();
-    else if (epd_model == 4)
-        EPD_BW_213_ice_set_sleep();
+    epd_seq_run(epd_drivers[epd_model], epd_drivers[epd_model]->sleep, &pos, &epd_job);
 
-    EPD_POWER_OFF();
-    epd_update_state = 0;
+    if (!epd_ram_valid)
+        EPD_POWER_OFF();
+    epd_update_state = EPD_STATE_IDLE;
 }
 
+// Runs every step that is due, returns the state so the caller knows an update is ongoing
 _attribute_ram_code_ uint8_t epd_state_handler(void)
 {
-    switch (epd_update_state)
+    while (epd_update_state && epd_wait_done())
+        epd_step();
+    return epd_update_state;
+}
+
+_attribute_ram_code_ uint8_t epd_update_running(void)
+{
+    return epd_update_state != EPD_STATE_IDLE;
+}
+
+// While an update is ongoing suspend only until the next step is due or the BUSY
+// pin reports idle. No deep retention, epd_buffer is not kept in retention RAM
+_attribute_ram_code_ void epd_set_wakeup(void)
+{
+    bls_pm_setSuspendMask(SUSPEND_ADV | SUSPEND_CONN);
+    bls_pm_setAppWakeupLowPower(epd_wait_start + epd_wait_ticks, 1);
+    if (epd_wait_idle)
     {
-    case 0:
-        // Nothing todo
-        break;
-    case 1: // check if refresh is done and sleep epd if so
-        if (epd_model == 1)
-        {
-            if (!EPD_IS_BUSY())
-                epd_set_sleep();
-        }
-        else
-        {
-            if (EPD_IS_BUSY())
-                epd_set_sleep();
-        }
-        break;
+        cpu_set_gpio_wakeup(EPD_BUSY, !epd_drivers[epd_model]->busy_level, 1);
+        bls_pm_setWakeupSource(PM_WAKEUP_PAD);
+    }
+    else
+    {
+        cpu_set_gpio_wakeup(EPD_BUSY, 0, 0);
     }
-    return epd_update_state;
 }
 
-_attribute_ram_code_ void FixBuffer(uint8_t *pSrc, uint8_t *pDst, uint16_t width, uint16_t height)
+uint8_t epd_band[8][EPD_BAND_PITCH]; // decoded lines waiting to be rotated
+
+// Collects a decoded line, returns 1 once its band is complete
+_attribute_ram_code_ static uint8_t epd_band_add(TIFFDRAW *pDraw)
 {
-    int x, y;
-    uint8_t *s, *d;
-    for (y = 0; y < (height / 8); y++)
-    { // byte rows
-        d = &pDst[y];
-        s = &pSrc[y * width];
-        for (x = 0; x < width; x++)
-        {
-            d[x * (height / 8)] = ~ucMirror[s[width - 1 - x]]; // invert and flip
-        }                                                      // for x
-    }                                                          // for y
+    int y = pDraw->y;
+    int len = (pDraw->iWidth + 7) / 8;
+
+    if ((y & 7) == 0)
+        memset(epd_band, 0xff, sizeof(epd_band)); // clear to white
+    if (len > EPD_BAND_PITCH)
+        len = EPD_BAND_PITCH;
+    memcpy(epd_band[y & 7], pDraw->pPixels, len);
+    return (y & 7) == 7 || y == pDraw->iHeight - 1;
 }
 
+// In place decode, see epd_decode_tiff
+uint16_t epd_tiff_src; // the TIFF in epd_buffer
+uint8_t epd_tiff_bands; // bands written
+uint8_t epd_tiff_overrun;
+
+// The visited bits of epd_transpose_bytes go to the file buffer of the decoder
+#if FILE_BUF_SIZE * 8 < epd_buffer_size
+#error "FILE_BUF_SIZE too small to transpose epd_buffer"
+#endif
+
 _attribute_ram_code_ void TIFFDraw(TIFFDRAW *pDraw)
 {
-    uint8_t uc = 0, ucSrcMask, ucDstMask, *s, *d;
-    int x, y;
+    int width = pDraw->iWidth;
+    uint8_t *dst = &epd_buffer[(pDraw->y / 8) * width];
 
-    s = pDraw->pPixels;
-    y = pDraw->y;                          // current line
-    d = &epd_buffer[(249 * 16) + (y / 8)]; // rotated 90 deg clockwise
-    ucDstMask = 0x80 >> (y & 7);           // destination mask
-    ucSrcMask = 0;                         // src mask
-    for (x = 0; x < pDraw->iWidth; x++)
+    if (!epd_band_add(pDraw) || epd_tiff_overrun)
+        return;
+    // only over TIFF data the decoder has read already
+    if (dst + width > &epd_buffer[epd_tiff_src + tiff.TIFFFile.iPos])
     {
-        // Slower to draw this way, but it allows us to use a single buffer
-        // instead of drawing and then converting the pixels to be the EPD format
-        if (ucSrcMask == 0)
-        { // load next source byte
-            ucSrcMask = 0x80;
-            uc = *s++;
-        }
-        if (!(uc & ucSrcMask))
-        { // black pixel
-            d[-(x * 16)] &= ~ucDstMask;
-        }
-        ucSrcMask >>= 1;
+        epd_tiff_overrun = 1;
+        return;
     }
+    // rotated 90 deg clockwise, a band becomes one line of column bytes
+    epd_rotate_band(epd_band, width, &dst[width - 1], -1);
+    epd_tiff_bands = pDraw->y / 8 + 1;
 }
 
-_attribute_ram_code_ void epd_display_tiff(uint8_t *pData, int iSize)
+// The image is width x rows of the panel, see epd_driver_t
+_attribute_ram_code_ static void epd_tiff_run(uint8_t *pData, int iSize, TIFF_DRAW_CALLBACK *pfnDraw)
 {
-    // test G4 decoder
-    memset(epd_buffer, 0xff, epd_buffer_size); // clear to white
-    TIFF_openRAW(&tiff, 250, 122, BITDIR_MSB_FIRST, pData, iSize, TIFFDraw);
-    TIFF_setDrawParameters(&tiff, 65536, TIFF_PIXEL_1BPP, 0, 0, 250, 122, NULL);
+    const epd_driver_t *drv = epd_drivers[epd_model];
+
+    TIFF_openRAW(&tiff, drv->width, drv->rows, BITDIR_MSB_FIRST, pData, iSize, pfnDraw);
+    TIFF_setDrawParameters(&tiff, 65536, TIFF_PIXEL_1BPP, 0, 0, drv->width, drv->rows, NULL);
     TIFF_decode(&tiff);
     TIFF_close(&tiff);
-    EPD_Display(epd_buffer, epd_buffer_size, 1);
+}
+
+// Decodes into epd_buffer, pData may be epd_buffer itself. The TIFF is moved
+// to the end of epd_buffer and the bands are written in front of it, then
+// turned into the columns of the frame. Returns 0 for a panel whose frame does
+// not fit, or a TIFF that takes more bytes than the lines it has left
+_attribute_ram_code_ static uint8_t epd_decode_tiff(uint8_t *pData, int iSize)
+{
+    const epd_driver_t *drv = epd_drivers[epd_model];
+    int bands = EPD_LINE_BYTES(drv);
+
+    if (EPD_FRAME_BYTES(drv) > sizeof(epd_buffer) || iSize > sizeof(epd_buffer))
+        return 0;
+    epd_tiff_src = sizeof(epd_buffer) - iSize;
+    memmove(&epd_buffer[epd_tiff_src], pData, iSize);
+    epd_tiff_bands = 0;
+    epd_tiff_overrun = 0;
+    epd_tiff_run(&epd_buffer[epd_tiff_src], iSize, TIFFDraw);
+    if (epd_tiff_overrun)
+        return 0;
+    // bands a broken image did not reach are white
+    memset(&epd_buffer[epd_tiff_bands * drv->width], 0xff, (bands - epd_tiff_bands) * drv->width);
+    epd_transpose_bytes(epd_buffer, bands, drv->width, tiff.ucFileBuf);
+    return 1;
+}
+
+// Streaming decode, every 8 decoded lines are one byte column of the frame
+// and go to the controller RAM as a one byte wide window, so the frame is
+// never held in epd_buffer
+uint8_t epd_strip[epd_width];
+uint8_t epd_strip_len; // lines of the panel
+uint8_t epd_strip_next;
+uint8_t epd_strip_cmd;
+uint16_t epd_strip_y_top;
+
+_attribute_ram_code_ static void epd_strip_send(void)
+{
+    epd_window_t win = {epd_strip_next, 1, 0, epd_strip_len};
+
+    EPD_SetRamWindow(epd_strip_y_top, &win);
+    EPD_WriteCmd(epd_strip_cmd);
+    EPD_DataBegin();
+    EPD_DataFeed(epd_strip, epd_strip_len);
+    EPD_DataEnd();
+    epd_strip_next++;
+}
+
+_attribute_ram_code_ void TIFFDrawStrip(TIFFDRAW *pDraw)
+{
+    if (epd_band_add(pDraw))
+    {
+        epd_rotate_band(epd_band, epd_strip_len, &epd_strip[epd_strip_len - 1], -1);
+        epd_strip_send();
+    }
+}
+
+// Called from the driver sequence in place of sending a plane
+_attribute_ram_code_ void epd_stream_tiff(uint8_t *pData, int iSize, uint16_t ram_y_start, uint8_t cmd)
+{
+    const epd_driver_t *drv = epd_drivers[epd_model];
+    epd_window_t full = {0, EPD_LINE_BYTES(drv), 0, drv->width};
+
+    epd_strip_len = drv->width < sizeof(epd_strip) ? drv->width : sizeof(epd_strip);
+    epd_strip_next = 0;
+    epd_strip_cmd = cmd;
+    epd_strip_y_top = ram_y_start;
+    epd_tiff_run(pData, iSize, TIFFDrawStrip);
+
+    // Columns a broken image did not reach are sent white
+    memset(epd_strip, 0xff, sizeof(epd_strip));
+    while (epd_strip_next < EPD_LINE_BYTES(drv))
+        epd_strip_send();
+
+    EPD_SetRamWindow(ram_y_start, &full);
+}
+
+// pData has to stay untouched until the refresh is done, the job may only be
+// started, and the TIFF decoded, once a running update is over
+_attribute_ram_code_ void epd_display_tiff(uint8_t *pData, int iSize)
+{
+    epd_job_t job = {0};
+    job.kind = EPD_JOB_TIFF;
+    job.image = pData;
+    job.size = iSize;
+    job.full_or_partial = 1;
+    epd_job_queue(&job);
+}
+
+// Shows a stored slot without going through epd_buffer, returns 0 for an empty
+// slot or while an update still needs the accent plane the slot replaces
+_attribute_ram_code_ uint8_t epd_display_slot(uint8_t slot, uint8_t full_or_partial)
+{
+    epd_job_t job = {0};
+    epd_slot_header_t header;
+
+    if (epd_update_state || !epd_slot_get(slot, &header) || !epd_slot_load_accent(slot))
+        return 0;
+    job.kind = EPD_JOB_SLOT;
+    job.addr = epd_slot_image(slot);
+    job.size = header.size;
+    job.full_or_partial = full_or_partial;
+    epd_job_queue(&job);
+    return 1;
+}
+
+// Black pixels of this TIFF become the accent plane, decoded in epd_buffer.
+// Returns 0 if it does not fit compressed
+_attribute_ram_code_ uint8_t epd_load_tiff_accent(uint8_t *pData, int iSize)
+{
+    if (!epd_model)
+        EPD_detect_model();
+    if (!epd_decode_tiff(pData, iSize))
+        return 0;
+    return epd_accent_pack(epd_buffer, EPD_FRAME_BYTES(epd_drivers[epd_model]), 1) != 0;
 }
 
 extern uint8_t mac_public[6];
@@ -240,55 +647,64 @@ _attribute_ram_code_ void epd_display(uint32_t time_is, uint16_t battery_mv, int
     {
         EPD_detect_model();
     }
-    uint16_t resolution_w = 250;
-    uint16_t resolution_h = 128; // 122 real pixel, but needed to have a full byte
-    if (epd_model == 1)
-    {
-        resolution_w = 250;
-        resolution_h = 128; // 122 real pixel, but needed to have a full byte
-    }
-    else if (epd_model == 2)
-    {
-        resolution_w = 250;
-        resolution_h = 128; // 122 real pixel, but needed to have a full byte
-    }
-    else if (epd_model == 3)
-    {
-        resolution_w = 200;
-        resolution_h = 200;
-    }
-    else if (epd_model == 4)
-    {
-        resolution_w = 250;
-        resolution_h = 128;
-    }
+    uint16_t resolution_w = epd_drivers[epd_model]->width;
+    uint16_t resolution_h = epd_drivers[epd_model]->height;
 
-    obdCreateVirtualDisplay(&obd, resolution_w, resolution_h, epd_temp);
+    // Drawn straight in the panel layout, see obdCreateVirtualEPD
+    epd_accent_clear();
+    obdCreateVirtualEPD(&obd, resolution_w, resolution_h, epd_buffer);
     obdFill(&obd, 0, 0); // fill with white
 
     char buff[100];
-    sprintf(buff, "ESL_%02X%02X%02X %s", mac_public[2], mac_public[1], mac_public[0], epd_model_string[epd_model]);
+    sprintf(buff, "ESL_%02X%02X%02X %s", mac_public[2], mac_public[1], mac_public[0], epd_drivers[epd_model]->name);
     obdWriteStringCustom(&obd, (GFXfont *)&Dialog_plain_16, 1, 17, (char *)buff, 1);
     sprintf(buff, "%s", BLE_conn_string[ble_get_connected()]);
     obdWriteStringCustom(&obd, (GFXfont *)&Dialog_plain_16, 232, 20, (char *)buff, 1);
     sprintf(buff, "%02d:%02d", ((time_is / 60) / 60) % 24, (time_is / 60) % 60);
-    obdWriteStringCustom(&obd, (GFXfont *)&DSEG14_Classic_Mini_Regular_40, 50, 65, (char *)buff, 1);
+    obdWriteStringCustom(&obd, (GFXfont *)&DSEG14_Classic_Mini_Regular_40_rle, 50, 65, (char *)buff, 1);
     sprintf(buff, "%d'C", EPD_read_temp());
-    obdWriteStringCustom(&obd, (GFXfont *)&Special_Elite_Regular_30, 10, 95, (char *)buff, 1);
+    obdWriteStringCustom(&obd, (GFXfont *)&Special_Elite_Regular_30_rle, 10, 95, (char *)buff, 1);
     sprintf(buff, "Battery %dmV", battery_mv);
     obdWriteStringCustom(&obd, (GFXfont *)&Dialog_plain_16, 10, 120, (char *)buff, 1);
-    FixBuffer(epd_temp, epd_buffer, resolution_w, resolution_h);
     EPD_Display(epd_buffer, resolution_w * resolution_h / 8, full_or_partial);
 }
 
+// Renders a template with the current field strings, returns 0 while an update
+// still needs epd_buffer or if there is no such template
+_attribute_ram_code_ uint8_t epd_display_template(uint8_t tpl, uint8_t full_or_partial)
+{
+    if (epd_update_state || !epd_template_valid(tpl))
+        return 0;
+
+    if (!epd_model)
+    {
+        EPD_detect_model();
+    }
+    uint16_t resolution_w = epd_drivers[epd_model]->width;
+    uint16_t resolution_h = epd_drivers[epd_model]->height;
+
+    epd_accent_clear();
+    obdCreateVirtualEPD(&obd, resolution_w, resolution_h, epd_buffer);
+    obdFill(&obd, 0, 0); // fill with white
+    epd_template_draw(&obd, tpl);
+    EPD_Display(epd_buffer, resolution_w * resolution_h / 8, full_or_partial);
+    return 1;
+}
+
 _attribute_ram_code_ void epd_display_char(uint8_t data)
 {
     int i;
+
+    if (epd_update_state)
+        return;
+    if (!epd_model)
+        EPD_detect_model();
     for (i = 0; i < epd_buffer_size; i++)
     {
         epd_buffer[i] = data;
     }
-    EPD_Display(epd_buffer, epd_buffer_size, 1);
+    epd_accent_clear();
+    EPD_Display(epd_buffer, EPD_FRAME_BYTES(epd_drivers[epd_model]), 1);
 }
 
 // Helper function to convert a single hex character to its integer value
@@ -320,6 +736,7 @@ void display_bitmap(char* hexBitmap, uint8_t partial) {
     }
 
     load_bitmap_to_epd_buffer(hexBitmap);
+    epd_accent_clear();
 
     // Display the bitmap
     EPD_Display(epd_buffer, epd_buffer_size, partial); // 1 for full refresh
@@ -5,16 +5,62 @@
 //#define epd_height 200
 //#define epd_width 200
 #define epd_buffer_size ((epd_height/8) * epd_width)
+#define epd_line_bytes (epd_height/8)
+
+// Window in controller RAM units, the same layout as epd_buffer:
+// x and w count bytes of 8 pixels within a line, y and h count lines
+typedef struct
+{
+    uint8_t x;
+    uint8_t w;
+    uint16_t y;
+    uint16_t h;
+} epd_window_t;
+
+#define EPD_MAX_WINDOWS 4
+
+// An update runs as a sequence of steps from epd_state_handler, the driver
+// sequences are split at every wait which tells what to wait for next
+#define EPD_STEP_DONE 0
+#define EPD_STEP_WAIT_MS(ms) (0x4000 | (ms))
+#define EPD_STEP_WAIT_IDLE(max_ms) (0x8000 | (max_ms))
+
+#define EPD_JOB_TEMP 0
+#define EPD_JOB_DISPLAY 1
+#define EPD_JOB_WINDOW 2
+#define EPD_JOB_TIFF 3 // image is a compressed TIFF, decoded while it is sent
+#define EPD_JOB_SLOT 4 // image is read from flash while it is sent, see epd_slot.h
+
+typedef struct
+{
+    uint8_t kind;
+    uint8_t phase; // 0 = the shared init sequence, 1 = the rest for this kind
+    uint16_t pos;  // offset in the current sequence
+    uint8_t full_or_partial;
+    int8_t temperature;
+    unsigned char *image;
+    uint32_t addr; // flash address of the image for EPD_JOB_SLOT
+    int size;
+    uint8_t win_count;
+    epd_window_t win[EPD_MAX_WINDOWS];
+} epd_job_t;
 
 void set_EPD_model(uint8_t model_nr);
 void init_epd(void);
 void display_bitmap(char* bitmap, uint8_t full_or_partial);
 int8_t EPD_read_temp(void);
 void EPD_Display(unsigned char *image, int size, uint8_t full_or_partial);
+void EPD_Display_window(unsigned char *image, const epd_window_t *win, uint8_t count);
+void epd_stream_tiff(uint8_t *pData, int iSize, uint16_t ram_y_start, uint8_t cmd);
 void epd_display_tiff(uint8_t *pData, int iSize);
+uint8_t epd_display_slot(uint8_t slot, uint8_t full_or_partial);
+uint8_t epd_display_template(uint8_t tpl, uint8_t full_or_partial);
+uint8_t epd_load_tiff_accent(uint8_t *pData, int iSize);
 void epd_display(uint32_t time_is, uint16_t battery_mv, int16_t temperature, uint8_t full_or_partial);
 void epd_set_sleep(void);
 uint8_t epd_state_handler(void);
+uint8_t epd_update_running(void);
+void epd_set_wakeup(void);
 void epd_display_char(uint8_t data);
 void epd_clear(void);
 void renderTextOverlay(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
@@ -5,9 +5,16 @@
 #include "stack/ble/ble.h"
 
 #include "epd.h"
+#include "epd_plane.h"
+#include "epd_xfer.h"
+#include "epd_slot.h"
+#include "schedule.h"
+#include "epd_template.h"
 #include "ble.h"
+#include "ble_conn.h"
+#include "main.h"
+#include "time.h"
 
-extern uint8_t *epd_temp;
 
 #define ASSERT_MIN_LEN(val, min_len) \
 	if (val < min_len)               \
@@ -15,8 +22,104 @@ extern uint8_t *epd_temp;
 		return 0;                    \
 	}
 
+// epd_buffer and the accent plane belong to a running update until its refresh
+// is done, a write meanwhile is dropped and answered with 0x17 opcode
+#define ASSERT_NOT_UPDATING(op)  \
+	if (epd_update_running())    \
+	{                            \
+		epd_ble_send_busy(op);   \
+		return 0;                \
+	}
+
 extern unsigned char epd_buffer[epd_buffer_size];
 unsigned int byte_pos = 0;
+uint8_t write_plane = 0; // 0 = black into epd_buffer, 1 = compressed accent plane
+epd_unpack_t upload;      // PackBits upload into epd_buffer, see 0x08
+RAM epd_xfer_t xfer;      // chunked upload into epd_buffer, see 0x0A, touched with get_time()
+
+// An unfinished session is dropped after this long without a chunk
+#define XFER_RESUME_TIMEOUT_S 600
+
+static void epd_ble_send_busy(uint8_t op)
+{
+	uint8_t out[2];
+
+	out[0] = 0x17;
+	out[1] = op;
+	bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, sizeof(out));
+}
+
+// Status of the chunked upload as notification: 0x0C, then see epd_xfer_status
+static void epd_ble_send_xfer_status(uint16_t first)
+{
+	uint8_t out[20];
+
+	out[0] = 0x0C;
+	bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, 1 + epd_xfer_status(&xfer, first, &out[1], sizeof(out) - 1));
+}
+
+// Session as notification: 0x0D id[4] size_hi size_lo chunk_size missing_hi missing_lo crc_hi crc_lo
+static void epd_ble_send_xfer_session(void)
+{
+	static const epd_xfer_t none = {0};
+	const epd_xfer_t *x = epd_xfer_open(&xfer) ? &xfer : &none;
+	uint16_t missing = x->chunks - x->received;
+	uint8_t out[12];
+
+	out[0] = 0x0D;
+	out[1] = x->id >> 24;
+	out[2] = x->id >> 16;
+	out[3] = x->id >> 8;
+	out[4] = x->id;
+	out[5] = x->size >> 8;
+	out[6] = x->size;
+	out[7] = x->chunk;
+	out[8] = missing >> 8;
+	out[9] = missing;
+	out[10] = x->crc >> 8;
+	out[11] = x->crc;
+	bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, sizeof(out));
+}
+
+// Slot result as notification: opcode slot, then for 0x0E and 0x11 ok,
+// for 0x10 valid size_hi size_lo accent_len_hi accent_len_lo crc_hi crc_lo
+static void epd_ble_send_slot(uint8_t op, uint8_t slot, uint8_t ok, const epd_slot_header_t *header)
+{
+	uint8_t out[9];
+
+	out[0] = op;
+	out[1] = slot;
+	out[2] = ok;
+	if (op != 0x10)
+	{
+		bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, 3);
+		return;
+	}
+	out[3] = ok ? header->size >> 8 : 0;
+	out[4] = ok ? header->size : 0;
+	out[5] = ok ? header->accent_len >> 8 : 0;
+	out[6] = ok ? header->accent_len : 0;
+	out[7] = ok ? header->crc >> 8 : 0;
+	out[8] = ok ? header->crc : 0;
+	bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, sizeof(out));
+}
+
+// epd_buffer only survives a disconnect while there is no deep retention
+// sleep, so an open session with an id keeps the device in suspend until it times out
+_attribute_ram_code_ uint8_t epd_ble_xfer_pending(void)
+{
+	epd_xfer_expire(&xfer, get_time(), XFER_RESUME_TIMEOUT_S);
+	return epd_xfer_open(&xfer) && xfer.id;
+}
+
+// The host is still writing epd_buffer or the accent plane: a chunked session
+// misses chunks or there were writes in the last seconds of this connection
+_attribute_ram_code_ uint8_t epd_ble_upload_running(void)
+{
+	if (epd_ble_xfer_pending())
+		return 1;
+	return ble_get_connected() && (epd_xfer_open(&xfer) || ble_conn_current() == BLE_PHASE_TRANSFER);
+}
 
 int epd_ble_handle_write(void *p)
 {
@@ -28,34 +131,229 @@ int epd_ble_handle_write(void *p)
 
 	switch (payload[0])
 	{
-	// Clear EPD display.
+	// Clear EPD display, this also drops the accent plane.
 	case 0x00:
 		ASSERT_MIN_LEN(payload_len, 2);
+		ASSERT_NOT_UPDATING(payload[0]);
 		memset(epd_buffer, payload[1], sizeof(epd_buffer));
-		ble_set_connection_speed(40);
+		epd_accent_clear();
+		epd_xfer_close(&xfer);
+		ble_conn_phase(BLE_PHASE_TRANSFER);
 		return 0;
-	// Push buffer to display.
+	// Push buffer to display, optional second byte 0 for a partial refresh of only what changed.
 	case 0x01:
-		ble_set_connection_speed(200);
-		EPD_Display(epd_buffer, epd_buffer_size, 1);
+		ble_conn_phase(BLE_PHASE_REFRESH);
+		EPD_Display(epd_buffer, epd_buffer_size, payload_len >= 2 ? payload[1] : 1);
 		return 0;
 	// Set byte_pos.
 	case 0x02:
 		ASSERT_MIN_LEN(payload_len, 3);
 		byte_pos = payload[1] << 8 | payload[2];
 		return 0;
-	// Write data to image buffer.
+	// Write data to image buffer, or to the accent plane after 0x06 0x01.
 	case 0x03:
+		ASSERT_NOT_UPDATING(payload[0]);
+		ble_conn_phase(BLE_PHASE_TRANSFER);
+		if (write_plane)
+		{
+			if (epd_accent_write(byte_pos, payload + 1, payload_len - 1))
+				byte_pos += payload_len - 1;
+			return 0;
+		}
 		if (byte_pos + payload_len - 1 >= sizeof(epd_buffer) + 1)
 		{
 			return 0;
 		}
 		memcpy(epd_buffer + byte_pos, payload + 1, payload_len - 1);
 		byte_pos += payload_len - 1;
+		epd_xfer_close(&xfer);
 		return 0;
 	case 0x04: // decode & display a TIFF image
+		ASSERT_NOT_UPDATING(payload[0]);
+		ble_conn_phase(BLE_PHASE_REFRESH);
 		epd_display_tiff(epd_buffer, byte_pos);
 		return 0;
+	// Push only a window of the buffer to display: x, w in bytes, y, h in lines.
+	case 0x05:
+	{
+		ASSERT_MIN_LEN(payload_len, 7);
+		epd_window_t win;
+		win.x = payload[1];
+		win.w = payload[2];
+		win.y = payload[3] << 8 | payload[4];
+		win.h = payload[5] << 8 | payload[6];
+		if (!win.w || !win.h || win.x + win.w > epd_line_bytes || win.y + win.h > epd_buffer_size / epd_line_bytes)
+			return 0;
+		ble_conn_phase(BLE_PHASE_REFRESH);
+		EPD_Display_window(epd_buffer, &win, 1);
+		return 0;
+	}
+	// Select the plane 0x02/0x03 write to: 0 = black, 1 = accent (red/yellow) as
+	// PackBits data, see epd_plane.h. Selecting the accent plane starts it empty.
+	case 0x06:
+		ASSERT_MIN_LEN(payload_len, 2);
+		ASSERT_NOT_UPDATING(payload[0]);
+		write_plane = payload[1] ? 1 : 0;
+		byte_pos = 0;
+		if (write_plane)
+			epd_accent_clear();
+		return 0;
+	// Decode the TIFF in the image buffer as accent plane, upload and show the black one after it.
+	case 0x07:
+		ASSERT_NOT_UPDATING(payload[0]);
+		epd_load_tiff_accent(epd_buffer, byte_pos);
+		return 0;
+	// PackBits compressed write, unpacked into the image buffer as it arrives.
+	// 0x08 starts the stream at byte_pos, 0x09 continues it, byte_pos follows
+	// the unpacked data. The accent plane is already PackBits so it is stored as with 0x03.
+	case 0x08:
+	case 0x09:
+		ASSERT_NOT_UPDATING(payload[0]);
+		ble_conn_phase(BLE_PHASE_TRANSFER);
+		if (write_plane)
+		{
+			if (epd_accent_write(byte_pos, payload + 1, payload_len - 1))
+				byte_pos += payload_len - 1;
+			return 0;
+		}
+		epd_xfer_close(&xfer);
+		if (payload[0] == 0x08)
+			epd_unpack_start(&upload, epd_buffer, sizeof(epd_buffer), byte_pos);
+		byte_pos = epd_unpack_feed(&upload, payload + 1, payload_len - 1);
+		return 0;
+	// Chunked upload into the image buffer, chunks can come in any order and
+	// without pauses. 0x0A size_hi size_lo chunk_size starts it from position 0.
+	// With id[4] crc_hi crc_lo appended the session survives a disconnect: the same
+	// start again continues it and gets the status back, the finished image is
+	// checked against the CRC and on a mismatch every chunk is asked for again.
+	case 0x0A:
+	{
+		ASSERT_MIN_LEN(payload_len, 4);
+		ASSERT_NOT_UPDATING(payload[0]);
+		uint16_t size = payload[1] << 8 | payload[2];
+		uint32_t id = 0;
+		uint16_t crc = 0;
+		if (size > sizeof(epd_buffer))
+			return 0;
+		if (payload_len >= 10)
+		{
+			id = payload[4] << 24 | payload[5] << 16 | payload[6] << 8 | payload[7];
+			crc = payload[8] << 8 | payload[9];
+		}
+		ble_conn_phase(BLE_PHASE_TRANSFER);
+		epd_xfer_expire(&xfer, get_time(), XFER_RESUME_TIMEOUT_S);
+		if (epd_xfer_resume(&xfer, id, size, payload[3], crc))
+		{
+			epd_xfer_touch(&xfer, get_time());
+			epd_ble_send_xfer_status(0);
+			return 0;
+		}
+		epd_xfer_start(&xfer, epd_buffer, size, payload[3], id, crc);
+		epd_xfer_touch(&xfer, get_time());
+		return 0;
+	}
+	// 0x0B seq_hi seq_lo crc_hi crc_lo data, the CRC-16/CCITT-FALSE is over the data.
+	// Once the last missing chunk arrived the status is notified and byte_pos set to the size.
+	case 0x0B:
+		ASSERT_MIN_LEN(payload_len, 6);
+		ASSERT_NOT_UPDATING(payload[0]);
+		if (!epd_xfer_open(&xfer))
+			return 0;
+		ble_conn_phase(BLE_PHASE_TRANSFER);
+		epd_xfer_touch(&xfer, get_time());
+		if (epd_xfer_chunk(&xfer, payload[1] << 8 | payload[2], payload[3] << 8 | payload[4], payload + 5, payload_len - 5) && epd_xfer_done(&xfer))
+		{
+			if (epd_xfer_verify(&xfer))
+				byte_pos = xfer.size;
+			epd_ble_send_xfer_status(0);
+		}
+		return 0;
+	// 0x0C first_hi first_lo notifies which chunks arrived, starting at chunk first.
+	case 0x0C:
+		ASSERT_MIN_LEN(payload_len, 3);
+		epd_ble_send_xfer_status(payload[1] << 8 | payload[2]);
+		return 0;
+	// Which session is open, for a host that reconnects.
+	case 0x0D:
+		epd_ble_send_xfer_session();
+		return 0;
+	// Flash slots, see epd_slot.h. 0x0E slot stores the image buffer and the accent plane.
+	case 0x0E:
+		ASSERT_MIN_LEN(payload_len, 2);
+		epd_ble_send_slot(0x0E, payload[1], epd_slot_store(payload[1], epd_buffer, epd_buffer_size), NULL);
+		return 0;
+	// 0x0F slot shows it straight from flash, optional third byte 0 for a partial refresh.
+	case 0x0F:
+		ASSERT_MIN_LEN(payload_len, 2);
+		ASSERT_NOT_UPDATING(payload[0]);
+		ble_conn_phase(BLE_PHASE_REFRESH);
+		epd_display_slot(payload[1], payload_len >= 3 ? payload[2] : 1);
+		return 0;
+	// 0x10 slot notifies what it holds.
+	case 0x10:
+	{
+		ASSERT_MIN_LEN(payload_len, 2);
+		epd_slot_header_t header;
+		epd_ble_send_slot(0x10, payload[1], epd_slot_get(payload[1], &header), &header);
+		return 0;
+	}
+	// 0x11 slot empties it.
+	case 0x11:
+		ASSERT_MIN_LEN(payload_len, 2);
+		epd_ble_send_slot(0x11, payload[1], epd_slot_erase(payload[1]), NULL);
+		return 0;
+	// Schedule, see schedule.h. 0x12 index time[4] action arg [full_or_partial] sets an
+	// entry, action 0 deletes it. Entries only survive a reset once saved with 0x13.
+	case 0x12:
+	{
+		ASSERT_MIN_LEN(payload_len, 8);
+		schedule_entry_t entry = {0};
+		entry.time = payload[2] << 24 | payload[3] << 16 | payload[4] << 8 | payload[5];
+		entry.action = payload[6];
+		entry.arg = payload[7];
+		entry.full_or_partial = payload_len >= 9 ? payload[8] : 1;
+		schedule_set(payload[1], &entry);
+		return 0;
+	}
+	// 0x13 0x00 clears the schedule, 0x13 0x01 saves it to flash. Notifies 0x13 entries.
+	case 0x13:
+	{
+		ASSERT_MIN_LEN(payload_len, 2);
+		uint8_t out[2];
+		if (payload[1])
+			schedule_save();
+		else
+			schedule_clear();
+		out[0] = 0x13;
+		out[1] = schedule_count();
+		bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, sizeof(out));
+		return 0;
+	}
+	// Templates, see epd_template.h. 0x14 tpl len_hi len_lo stores the first len bytes of
+	// the image buffer, uploaded like an image, as template. Notifies 0x14 tpl ok.
+	case 0x14:
+	{
+		ASSERT_MIN_LEN(payload_len, 4);
+		uint8_t out[3];
+		uint16_t len = payload[2] << 8 | payload[3];
+		out[0] = 0x14;
+		out[1] = payload[1];
+		out[2] = len <= sizeof(epd_buffer) && epd_template_store(payload[1], epd_buffer, len);
+		bls_att_pushNotifyData(EPD_BLE_CMD_OUT_DP_H, out, sizeof(out));
+		return 0;
+	}
+	// 0x15 field text sets the string of a field.
+	case 0x15:
+		ASSERT_MIN_LEN(payload_len, 2);
+		epd_template_set_field(payload[1], payload + 2, payload_len - 2);
+		return 0;
+	// 0x16 tpl [full_or_partial] renders the template with the current fields and shows it.
+	case 0x16:
+		ASSERT_MIN_LEN(payload_len, 2);
+		ASSERT_NOT_UPDATING(payload[0]);
+		ble_conn_phase(BLE_PHASE_REFRESH);
+		epd_display_template(payload[1], payload_len >= 3 ? payload[2] : 1);
+		return 0;
 	default:
 		return 0;
 	}
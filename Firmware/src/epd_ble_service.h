@@ -1,3 +1,7 @@
 #pragma once
 
-int epd_ble_handle_write(void * p);
\ No newline at end of file
+#include <stdint.h>
+
+int epd_ble_handle_write(void * p);
+uint8_t epd_ble_xfer_pending(void);
+uint8_t epd_ble_upload_running(void);
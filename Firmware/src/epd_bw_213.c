@@ -3,6 +3,7 @@
 #include "main.h"
 #include "epd.h"
 #include "epd_spi.h"
+#include "epd_driver.h"
 #include "epd_bw_213.h"
 #include "drivers.h"
 #include "stack/ble/ble.h"
@@ -10,114 +11,61 @@
 // UC8151C or similar EPD Controller
 
 #define lut_bw_213_refresh_time 10
-uint8_t lut_bw_213_20_part[] =
-    {
-        0x20, 0x00, lut_bw_213_refresh_time, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-uint8_t lut_bw_213_22_part[] =
-    {
-        0x22, 0x80, lut_bw_213_refresh_time, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-uint8_t lut_bw_213_23_part[] =
-    {
-        0x23, 0x40, lut_bw_213_refresh_time, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-
-
-_attribute_ram_code_ uint8_t EPD_BW_213_read_temp(void)
-{
-    uint8_t epd_temperature = 0 ;
-    EPD_WriteCmd(0x04);
-
-    // check BUSY pin
-    EPD_CheckStatus(100);
-
-    EPD_WriteCmd(0x40);
-    epd_temperature = EPD_SPI_read();
-    EPD_SPI_read();
-
-    // power off
-    EPD_WriteCmd(0x02);
-
-    // deep sleep
-    EPD_WriteCmd(0x07);
-    EPD_WriteData(0xa5);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ uint8_t EPD_BW_213_Display(unsigned char *image, int size, uint8_t full_or_partial)
-{
-    uint8_t epd_temperature = 0 ;
-    
-    // Booster soft start
-    EPD_WriteCmd(0x06);
-    EPD_WriteData(0x17);
-    EPD_WriteData(0x17);
-    EPD_WriteData(0x17);
-    // power on
-    EPD_WriteCmd(0x04);
-
-    // check BUSY pin
-    EPD_CheckStatus(100);
-
-    EPD_WriteCmd(0x40);
-    epd_temperature = EPD_SPI_read();
-    EPD_SPI_read();
-
-    // panel setting
-    EPD_WriteCmd(0x00);
-    if (full_or_partial)
-        EPD_WriteData(0b00011111);
-    else
-        EPD_WriteData(0b00111111);
-    EPD_WriteData(0x0f);
-
-    // resolution setting
-    EPD_WriteCmd(0x61);
-    EPD_WriteData(0x80);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x28);
-
-    // Vcom and data interval setting
-    EPD_WriteCmd(0X50);
-    EPD_WriteData(0x97);
-
-    if (!full_or_partial)
-    {
-        EPD_send_lut(lut_bw_213_20_part, sizeof(lut_bw_213_20_part));
-        EPD_send_empty_lut(0x21, 260);
-        EPD_send_lut(lut_bw_213_22_part, sizeof(lut_bw_213_22_part));
-        EPD_send_lut(lut_bw_213_23_part, sizeof(lut_bw_213_23_part));
-        EPD_send_empty_lut(0x24, 260);
-
-        EPD_WriteCmd(0x10);
-        int i;
-        for (i = 0; i < size; i++)
-        {
-            EPD_WriteData(~image[i]);
-        }
-    }
-    // load image data to EPD
-    EPD_LoadImage(image, size, 0x13);
-
-    // trigger display refresh
-    EPD_WriteCmd(0x12);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ void EPD_BW_213_set_sleep(void)
-{
-    // Vcom and data interval setting
-    EPD_WriteCmd(0x50);
-    EPD_WriteData(0xf7);
-
-    // power off
-    EPD_WriteCmd(0x02);
-
-    // deep sleep
-    EPD_WriteCmd(0x07);
-    EPD_WriteData(0xa5);
-
-}
\ No newline at end of file
+// Partial refresh LUTs, the ones for 0x21 and 0x24 stay empty
+const uint8_t lut_bw_213_part[] = {
+    44, 0x20, 0x00, lut_bw_213_refresh_time, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    EPD_OP_FILL, 0x21, 0x00, 0x01, 0x05,
+    42, 0x22, 0x80, lut_bw_213_refresh_time, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    42, 0x23, 0x40, lut_bw_213_refresh_time, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    EPD_OP_FILL, 0x24, 0x00, 0x01, 0x05,
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_init[] = {
+    3, 0x06, 0x17, 0x17, 0x17, // Booster soft start
+    0, 0x04,                   // power on
+    EPD_OP_WAIT_IDLE, 100,     // check BUSY pin
+    EPD_OP_READ_TEMP, 0x40,
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_temp[] = {
+    0, 0x02,       // power off
+    1, 0x07, 0xa5, // deep sleep
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_display[] = {
+    EPD_OP_IF_FULL, 4,
+    2, 0x00, 0b00011111, 0x0f, // panel setting
+    EPD_OP_IF_PARTIAL, 4,
+    2, 0x00, 0b00111111, 0x0f, // panel setting, LUT from register
+    3, 0x61, 0x80, 0x01, 0x28, // resolution setting
+    1, 0X50, 0x97,             // Vcom and data interval setting
+    EPD_OP_IF_PARTIAL, 3,
+    EPD_OP_LUT,
+    EPD_OP_PLANE_INV, 0x10,    // old data is the inverted new one
+    EPD_OP_PLANE, 0x13,        // load image data to EPD
+    EPD_OP_WAIT_MS, 2,
+    0, 0x12,                   // trigger display refresh
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_sleep[] = {
+    1, 0x50, 0xf7, // Vcom and data interval setting
+    0, 0x02,       // power off
+    1, 0x07, 0xa5, // deep sleep
+    EPD_OP_END};
+
+const epd_driver_t epd_driver_bw_213 = {
+    .name = "BW213",
+    .width = 250,
+    .height = 128, // 122 real pixel, but needed to have a full byte
+    .rows = 122,
+    .planes = 1,
+    .busy_level = 0,
+    .ram_y_start = 0,
+    .detect = NULL, // whatever does not answer the SSD16xx probes
+    .init = EPD_BW_213_init,
+    .temp = EPD_BW_213_temp,
+    .display = EPD_BW_213_display,
+    .window = NULL,
+    .sleep = EPD_BW_213_sleep,
+    .lut_part = lut_bw_213_part,
+};
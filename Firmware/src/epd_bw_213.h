@@ -1,5 +1,3 @@
 #pragma once
 
-uint8_t EPD_BW_213_read_temp(void);
-uint8_t EPD_BW_213_Display(unsigned char *image, int size, uint8_t full_or_partial);
-void EPD_BW_213_set_sleep(void);
\ No newline at end of file
+extern const epd_driver_t epd_driver_bw_213;
@@ -3,6 +3,7 @@
 #include "main.h"
 #include "epd.h"
 #include "epd_spi.h"
+#include "epd_driver.h"
 #include "epd_bw_213_ice.h"
 #include "drivers.h"
 #include "stack/ble/ble.h"
@@ -10,7 +11,8 @@
 // SSD1675 mixed with SSD1680 EPD Controller
 
 #define BW_213_ice_Len 50
-uint8_t LUT_BW_213_ice_part[] = {
+const uint8_t LUT_BW_213_ice_part[] = {
+100, 0x32, // Write LUT register
 
   0x40,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -28,8 +30,7 @@ uint8_t LUT_BW_213_ice_part[] = {
   0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00,
-
-
+EPD_OP_END
 };
 
 _attribute_ram_code_ uint8_t EPD_BW_213_ice_detect(void)
@@ -44,226 +45,71 @@ _attribute_ram_code_ uint8_t EPD_BW_213_ice_detect(void)
     return 1;
 }
 
-_attribute_ram_code_ int8_t EPD_BW_213_ice_read_temp(void)
-{
-    int8_t epd_temperature = 0 ;
-    
-    // SW Reset
-    EPD_WriteCmd(0x12);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Set Analog Block control
-    EPD_WriteCmd(0x74);
-    EPD_WriteData(0x54);
-    // Set Digital Block control
-    EPD_WriteCmd(0x7E);
-    EPD_WriteData(0x3B);
-    
-    // ACVCOM Setting
-    EPD_WriteCmd(0x2B);
-    EPD_WriteData(0x04);
-    EPD_WriteData(0x63);
-
-    // Booster soft start
-    EPD_WriteCmd(0x0C);
-    EPD_WriteData(0x8B);
-    EPD_WriteData(0x9C);
-    EPD_WriteData(0x96);
-    EPD_WriteData(0x0F);
-
-    // Driver output control
-    EPD_WriteCmd(0x01);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x01);
-
-    // Data entry mode setting
-    EPD_WriteCmd(0x11);
-    EPD_WriteData(0x01);
-
-    // Temperature sensor control
-    EPD_WriteCmd(0x18);
-    EPD_WriteData(0x80);
-
-    // Set RAM X- Address Start/End
-    EPD_WriteCmd(0x44);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x0F);
-
-    // Set RAM Y- Address Start/End
-    EPD_WriteCmd(0x45);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x2E);
-    EPD_WriteData(0x00);
-
-    // Border waveform control
-    EPD_WriteCmd(0x3C);
-    EPD_WriteData(0x05);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xA1);
-
-    // Master Activation
-    EPD_WriteCmd(0x20);
-    
-    EPD_CheckStatus_inverted(100);
-
-    // Temperature sensor read from register
-    EPD_WriteCmd(0x1B);
-    epd_temperature = EPD_SPI_read();    
-    EPD_SPI_read();
-
-    WaitMs(5);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xB1);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    EPD_CheckStatus_inverted(100);
-    
-    // Display update control
-    EPD_WriteCmd(0x21);
-    EPD_WriteData(0x03);
-    
-    // deep sleep
-    EPD_WriteCmd(0x10);
-    EPD_WriteData(0x01);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ int8_t EPD_BW_213_ice_Display(unsigned char *image, int size, uint8_t full_or_partial)
-{    
-    int8_t epd_temperature = 0 ;
-    
-    // SW Reset
-    EPD_WriteCmd(0x12);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Set Analog Block control
-    EPD_WriteCmd(0x74);
-    EPD_WriteData(0x54);
-    // Set Digital Block control
-    EPD_WriteCmd(0x7E);
-    EPD_WriteData(0x3B);
-    
-    // ACVCOM Setting
-    EPD_WriteCmd(0x2B);
-    EPD_WriteData(0x04);
-    EPD_WriteData(0x63);
-
-    // Booster soft start
-    EPD_WriteCmd(0x0C);
-    EPD_WriteData(0x8B);
-    EPD_WriteData(0x9C);
-    EPD_WriteData(0x96);
-    EPD_WriteData(0x0F);
-
-    // Driver output control
-    EPD_WriteCmd(0x01);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x01);
-
-    // Data entry mode setting
-    EPD_WriteCmd(0x11);
-    EPD_WriteData(0x01);
-
-    // Temperature sensor control
-    EPD_WriteCmd(0x18);
-    EPD_WriteData(0x80);
-
-    // Set RAM X- Address Start/End
-    EPD_WriteCmd(0x44);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x0F);
-
-    // Set RAM Y- Address Start/End
-    EPD_WriteCmd(0x45);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x2E);
-    EPD_WriteData(0x00);
-
-    // Border waveform control
-    EPD_WriteCmd(0x3C);
-    EPD_WriteData(0x01);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xA1);
-
-    // Master Activation
-    EPD_WriteCmd(0x20);
-    
-    EPD_CheckStatus_inverted(100);
-
-    // Temperature sensor read from register
-    EPD_WriteCmd(0x1B);
-    epd_temperature = EPD_SPI_read();    
-    EPD_SPI_read();
-
-    WaitMs(5);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xB1);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    EPD_CheckStatus_inverted(100);
-    
-    // Display update control
-    EPD_WriteCmd(0x21);
-    EPD_WriteData(0x03);
-
-    // Set RAM X address
-    EPD_WriteCmd(0x4E);
-    EPD_WriteData(0x00);
-
-    // Set RAM Y address
-    EPD_WriteCmd(0x4F);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-
-    EPD_LoadImage(image, size, 0x24);
-
-    // Set RAM X address
-    EPD_WriteCmd(0x4E);
-    EPD_WriteData(0x00);
-
-    int i;
-    if (!full_or_partial)
-    {
-        EPD_WriteCmd(0x32);
-        for (i = 0; i < sizeof(LUT_BW_213_ice_part); i++)
-        {
-            EPD_WriteData(LUT_BW_213_ice_part[i]);
-        }
-    }      
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xC7);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ void EPD_BW_213_ice_set_sleep(void)
-{
-    // deep sleep
-    EPD_WriteCmd(0x10);
-    EPD_WriteData(0x01);
-
-}
+const uint8_t EPD_BW_213_ice_init[] = {
+    0, 0x12,                         // SW Reset
+    EPD_OP_WAIT_IDLE, 100,
+    1, 0x74, 0x54,                   // Set Analog Block control
+    1, 0x7E, 0x3B,                   // Set Digital Block control
+    2, 0x2B, 0x04, 0x63,             // ACVCOM Setting
+    4, 0x0C, 0x8B, 0x9C, 0x96, 0x0F, // Booster soft start
+    3, 0x01, 0x28, 0x01, 0x01,       // Driver output control
+    1, 0x11, 0x01,                   // Data entry mode setting
+    1, 0x18, 0x80,                   // Temperature sensor control
+    2, 0x44, 0x00, 0x0F,             // Set RAM X- Address Start/End
+    4, 0x45, 0x28, 0x01, 0x2E, 0x00, // Set RAM Y- Address Start/End
+    1, 0x3C, 0x01,                   // Border waveform control
+    1, 0x22, 0xA1,                   // Display update control
+    0, 0x20,                         // Master Activation
+    EPD_OP_WAIT_IDLE, 100,
+    EPD_OP_READ_TEMP, 0x1B,          // Temperature sensor read from register
+    EPD_OP_WAIT_MS, 5,
+    1, 0x22, 0xB1,                   // Display update control
+    0, 0x20,                         // Master Activation
+    EPD_OP_WAIT_IDLE, 100,
+    1, 0x21, 0x03,                   // Display update control
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_ice_temp[] = {
+    1, 0x10, 0x01, // deep sleep
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_ice_display[] = {
+    1, 0x4E, 0x00,       // Set RAM X address
+    2, 0x4F, 0x28, 0x01, // Set RAM Y address
+    EPD_OP_PLANE, 0x24,
+    EPD_OP_WAIT_MS, 2,
+    1, 0x4E, 0x00,       // Set RAM X address
+    EPD_OP_IF_PARTIAL, 1,
+    EPD_OP_LUT,
+    1, 0x22, 0xC7, // Display update control
+    0, 0x20,       // Master Activation
+    EPD_OP_END};
+
+// Needs the controller RAM to still hold the last frame
+const uint8_t EPD_BW_213_ice_window[] = {
+    EPD_OP_WINDOWS, 0x24,
+    EPD_OP_LUT,
+    1, 0x22, 0xC7, // Display update control
+    0, 0x20,       // Master Activation
+    EPD_OP_END};
+
+const uint8_t EPD_BW_213_ice_sleep[] = {
+    1, 0x10, 0x01, // deep sleep
+    EPD_OP_END};
+
+const epd_driver_t epd_driver_bw_213_ice = {
+    .name = "213ICE",
+    .width = 250,
+    .height = 128,
+    .rows = 122,
+    .planes = 1,
+    .busy_level = 1,
+    .ram_y_start = 0x128,
+    .detect = EPD_BW_213_ice_detect,
+    .init = EPD_BW_213_ice_init,
+    .temp = EPD_BW_213_ice_temp,
+    .display = EPD_BW_213_ice_display,
+    .window = EPD_BW_213_ice_window,
+    .sleep = EPD_BW_213_ice_sleep,
+    .lut_part = LUT_BW_213_ice_part,
+};
@@ -3,6 +3,7 @@
 #include "main.h"
 #include "epd.h"
 #include "epd_spi.h"
+#include "epd_driver.h"
 #include "epd_bwr_154.h"
 #include "drivers.h"
 #include "stack/ble/ble.h"
@@ -10,7 +11,8 @@
 // SSD1675 mixed with SSD1680 EPD Controller
 
 #define BWR_154_Len 50
-uint8_t LUT_bwr_154_part[] = {
+const uint8_t LUT_bwr_154_part[] = {
+153, 0x32, // Write LUT register
 
 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -31,8 +33,8 @@ BWR_154_Len, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-0x00, 0x00, 0x00, 
-
+0x00, 0x00, 0x00,
+EPD_OP_END
 };
 
 #define EPD_BWR_154_test_pattern 0xA5
@@ -42,12 +44,12 @@ _attribute_ram_code_ uint8_t EPD_BWR_154_detect(void)
     EPD_WriteCmd(0x12);
     WaitMs(10);
 
-    EPD_WriteCmd(0x32);
+    EPD_WriteCmd(0x32);// This controller has a <100 bytes LUT storage so we test if thats existing.
+    EPD_DataBegin();
+    EPD_DataFill(EPD_BWR_154_test_pattern, 65);
+    EPD_DataEnd();
+
     int i;
-    for (i = 0; i < 65; i++)// This controller has a <100 bytes LUT storage so we test if thats existing.
-    {
-        EPD_WriteData(EPD_BWR_154_test_pattern);
-    }
     EPD_WriteCmd(0x33);
     for (i = 0; i < 65; i++)
     {
@@ -57,172 +59,58 @@ _attribute_ram_code_ uint8_t EPD_BWR_154_detect(void)
     return 1;
 }
 
-_attribute_ram_code_ int8_t EPD_BWR_154_read_temp(void)
-{
-    int8_t epd_temperature = 0 ;
-    
-    // SW Reset
-    EPD_WriteCmd(0x12);
-
-    EPD_CheckStatus_inverted(100);
-
-    EPD_WriteCmd(0x01);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x01);
-
-    // Data entry mode setting
-    EPD_WriteCmd(0x11);
-    EPD_WriteData(0x01);
-
-    // Set RAM X- Address Start/End
-    EPD_WriteCmd(0x44);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x18);
-
-    // Set RAM Y- Address Start/End
-    EPD_WriteCmd(0x45);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x61);
-    EPD_WriteData(0x00);
-
-    // Border waveform control
-    EPD_WriteCmd(0x3C);
-    EPD_WriteData(0x05);
-
-    // Temperature sensor control
-    EPD_WriteCmd(0x18);
-    EPD_WriteData(0x80);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xB1);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Temperature sensor read from register
-    EPD_WriteCmd(0x1B);
-    epd_temperature = EPD_SPI_read();    
-    EPD_SPI_read();
-
-    WaitMs(5);
-    
-    // deep sleep
-    EPD_WriteCmd(0x10);
-    EPD_WriteData(0x01);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ int8_t EPD_BWR_154_Display(unsigned char *image, int size, uint8_t full_or_partial)
-{
-    int8_t epd_temperature = 0 ;
-    
-    // SW Reset
-    EPD_WriteCmd(0x12);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Driver output control
-    EPD_WriteCmd(0x01);
-    EPD_WriteData(0xc7);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x01);
-
-    // Data entry mode setting
-    EPD_WriteCmd(0x11);
-    EPD_WriteData(0x01);
-
-    // Set RAM X- Address Start/End
-    EPD_WriteCmd(0x44);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x18);
-
-    // Set RAM Y- Address Start/End
-    EPD_WriteCmd(0x45);
-    EPD_WriteData(0xc7);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x00);
-
-    // Border waveform control
-    EPD_WriteCmd(0x3C);
-    EPD_WriteData(0x05);
-
-    // Temperature sensor control
-    EPD_WriteCmd(0x18);
-    EPD_WriteData(0x80);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xB1);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Temperature sensor read from register
-    EPD_WriteCmd(0x1B);
-    epd_temperature = EPD_SPI_read();    
-    EPD_SPI_read();
-
-    WaitMs(5);
-
-    // Set RAM X address
-    EPD_WriteCmd(0x4E);
-    EPD_WriteData(0x00);
-
-    // Set RAM Y address
-    EPD_WriteCmd(0x4F);
-    EPD_WriteData(0xc7);
-    EPD_WriteData(0x00);
-
-    EPD_LoadImage(image, size, 0x24);
-
-    // Set RAM X address
-    EPD_WriteCmd(0x4E);
-    EPD_WriteData(0x00);
-
-    // Set RAM Y address
-    EPD_WriteCmd(0x4F);
-    EPD_WriteData(0xc7);
-    EPD_WriteData(0x00);
-
-    EPD_WriteCmd(0x26);// RED Color TODO make something out of it :)
-    int i;
-    for (i = 0; i < size; i++)
-    {
-        EPD_WriteData(0x00);
-    }
-
-    if (!full_or_partial)
-    {
-        EPD_WriteCmd(0x32);
-        for (i = 0; i < sizeof(LUT_bwr_154_part); i++)
-        {
-            EPD_WriteData(LUT_bwr_154_part[i]);
-        }
-    }
-    
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xC7);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ void EPD_BWR_154_set_sleep(void)
-{
-    // deep sleep
-    EPD_WriteCmd(0x10);
-    EPD_WriteData(0x01);
-
-}
+const uint8_t EPD_BWR_154_init[] = {
+    0, 0x12,                         // SW Reset
+    EPD_OP_WAIT_IDLE, 100,
+    3, 0x01, 0xc7, 0x00, 0x01,       // Driver output control
+    1, 0x11, 0x01,                   // Data entry mode setting
+    2, 0x44, 0x00, 0x18,             // Set RAM X- Address Start/End
+    4, 0x45, 0xc7, 0x00, 0x00, 0x00, // Set RAM Y- Address Start/End
+    1, 0x3C, 0x05,                   // Border waveform control
+    1, 0x18, 0x80,                   // Temperature sensor control
+    1, 0x22, 0xB1,                   // Display update control
+    0, 0x20,                         // Master Activation
+    EPD_OP_WAIT_IDLE, 100,
+    EPD_OP_READ_TEMP, 0x1B,          // Temperature sensor read from register
+    EPD_OP_WAIT_MS, 5,
+    EPD_OP_END};
+
+const uint8_t EPD_BWR_154_temp[] = {
+    1, 0x10, 0x01, // deep sleep
+    EPD_OP_END};
+
+const uint8_t EPD_BWR_154_display[] = {
+    1, 0x4E, 0x00,       // Set RAM X address
+    2, 0x4F, 0xc7, 0x00, // Set RAM Y address
+    EPD_OP_PLANE, 0x24,
+    EPD_OP_WAIT_MS, 2,
+    1, 0x4E, 0x00,       // Set RAM X address
+    2, 0x4F, 0xc7, 0x00, // Set RAM Y address
+    EPD_OP_ACCENT, 0x26, // red
+    EPD_OP_IF_PARTIAL, 1,
+    EPD_OP_LUT,
+    1, 0x22, 0xC7, // Display update control
+    0, 0x20,       // Master Activation
+    EPD_OP_END};
+
+const uint8_t EPD_BWR_154_sleep[] = {
+    1, 0x10, 0x01, // deep sleep
+    EPD_OP_END};
+
+// The RAM geometry does not match epd_buffer, so no windowed updates
+const epd_driver_t epd_driver_bwr_154 = {
+    .name = "BWR154",
+    .width = 200,
+    .height = 200,
+    .rows = 200,
+    .planes = 2,
+    .busy_level = 1,
+    .ram_y_start = 0xc7,
+    .detect = EPD_BWR_154_detect,
+    .init = EPD_BWR_154_init,
+    .temp = EPD_BWR_154_temp,
+    .display = EPD_BWR_154_display,
+    .window = NULL,
+    .sleep = EPD_BWR_154_sleep,
+    .lut_part = LUT_bwr_154_part,
+};
@@ -1,6 +1,4 @@
 #pragma once
 
 uint8_t EPD_BWR_154_detect(void);
-int8_t EPD_BWR_154_read_temp(void);
-int8_t EPD_BWR_154_Display(unsigned char *image, int size, uint8_t full_or_partial);
-void EPD_BWR_154_set_sleep(void);
+extern const epd_driver_t epd_driver_bwr_154;
@@ -3,6 +3,7 @@
 #include "main.h"
 #include "epd.h"
 #include "epd_spi.h"
+#include "epd_driver.h"
 #include "epd_bwy_350.h"
 #include "drivers.h"
 #include "stack/ble/ble.h"
@@ -10,7 +11,8 @@
 // SSD1675 mixed with SSD1680 EPD Controller
 
 #define BWY_350_Len 50
-uint8_t LUT_BWY_350_part[] = {
+const uint8_t LUT_BWY_350_part[] = {
+100, 0x32, // Write LUT register
 
   0x40,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -28,242 +30,71 @@ uint8_t LUT_BWY_350_part[] = {
   0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00,
-
-
+EPD_OP_END
 };
 
-_attribute_ram_code_ uint8_t EPD_BWY_350_detect(void)
-{
-    // SW Reset
-    EPD_WriteCmd(0x12);
-    WaitMs(10);
-
-    EPD_WriteCmd(0x2F);
-    if(EPD_SPI_read() != 0x01)
-        return 0;
-    return 1;
-}
-
-_attribute_ram_code_ uint8_t EPD_BWY_350_read_temp(void)
-{
-    uint8_t epd_temperature = 0 ;
-    
-    // SW Reset
-    EPD_WriteCmd(0x12);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Set Analog Block control
-    EPD_WriteCmd(0x74);
-    EPD_WriteData(0x54);
-    // Set Digital Block control
-    EPD_WriteCmd(0x7E);
-    EPD_WriteData(0x3B);
-    
-    // ACVCOM Setting
-    EPD_WriteCmd(0x2B);
-    EPD_WriteData(0x04);
-    EPD_WriteData(0x63);
-
-    // Booster soft start
-    EPD_WriteCmd(0x0C);
-    EPD_WriteData(0x8B);
-    EPD_WriteData(0x9C);
-    EPD_WriteData(0x96);
-    EPD_WriteData(0x0F);
-
-    // Driver output control
-    EPD_WriteCmd(0x01);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x01);
-
-    // Data entry mode setting
-    EPD_WriteCmd(0x11);
-    EPD_WriteData(0x01);
-
-    // Temperature sensor control
-    EPD_WriteCmd(0x18);
-    EPD_WriteData(0x80);
-
-    // Set RAM X- Address Start/End
-    EPD_WriteCmd(0x44);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x0C);
-
-    // Set RAM Y- Address Start/End
-    EPD_WriteCmd(0x45);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x54);
-    EPD_WriteData(0x00);
-
-    // Border waveform control
-    EPD_WriteCmd(0x3C);
-    EPD_WriteData(0x01);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xA1);
-
-    // Master Activation
-    EPD_WriteCmd(0x20);
-    
-    EPD_CheckStatus_inverted(100);
-
-    // Temperature sensor read from register
-    EPD_WriteCmd(0x1B);
-    epd_temperature = EPD_SPI_read();    
-    EPD_SPI_read();
-
-    WaitMs(5);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xB1);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    EPD_CheckStatus_inverted(100);
-    
-    // Display update control
-    EPD_WriteCmd(0x21);
-    EPD_WriteData(0x03);
-    
-    // deep sleep
-    EPD_WriteCmd(0x10);
-    EPD_WriteData(0x01);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ uint8_t EPD_BWY_350_Display(unsigned char *image, int size, uint8_t full_or_partial)
-{    
-    uint8_t epd_temperature = 0 ;
-    
-    // SW Reset
-    EPD_WriteCmd(0x12);
-
-    EPD_CheckStatus_inverted(100);
-
-    // Set Analog Block control
-    EPD_WriteCmd(0x74);
-    EPD_WriteData(0x54);
-    // Set Digital Block control
-    EPD_WriteCmd(0x7E);
-    EPD_WriteData(0x3B);
-    
-    // ACVCOM Setting
-    EPD_WriteCmd(0x2B);
-    EPD_WriteData(0x04);
-    EPD_WriteData(0x63);
-
-    // Booster soft start
-    EPD_WriteCmd(0x0C);
-    EPD_WriteData(0x8B);
-    EPD_WriteData(0x9C);
-    EPD_WriteData(0x96);
-    EPD_WriteData(0x0F);
-
-    // Driver output control
-    EPD_WriteCmd(0x01);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x01);
-
-    // Data entry mode setting
-    EPD_WriteCmd(0x11);
-    EPD_WriteData(0x01);
-
-    // Temperature sensor control
-    EPD_WriteCmd(0x18);
-    EPD_WriteData(0x80);
-
-    // Set RAM X- Address Start/End
-    EPD_WriteCmd(0x44);
-    EPD_WriteData(0x00);
-    EPD_WriteData(0x0C);
-
-    // Set RAM Y- Address Start/End
-    EPD_WriteCmd(0x45);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-    EPD_WriteData(0x54);
-    EPD_WriteData(0x00);
-
-    // Border waveform control
-    EPD_WriteCmd(0x3C);
-    EPD_WriteData(0x01);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xA1);
-
-    // Master Activation
-    EPD_WriteCmd(0x20);
-    
-    EPD_CheckStatus_inverted(100);
-
-    // Temperature sensor read from register
-    EPD_WriteCmd(0x1B);
-    epd_temperature = EPD_SPI_read();    
-    EPD_SPI_read();
-
-    WaitMs(5);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xB1);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    EPD_CheckStatus_inverted(100);
-    
-    // Display update control
-    EPD_WriteCmd(0x21);
-    EPD_WriteData(0x03);
-
-    // Set RAM X address
-    EPD_WriteCmd(0x4E);
-    EPD_WriteData(0x00);
-
-    // Set RAM Y address
-    EPD_WriteCmd(0x4F);
-    EPD_WriteData(0x28);
-    EPD_WriteData(0x01);
-
-    EPD_LoadImage(image, size, 0x24);
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0x40);
-
-    int i;
-    if (!full_or_partial)
-    {
-        EPD_WriteCmd(0x32);
-        for (i = 0; i < sizeof(LUT_BWY_350_part); i++)
-        {
-            EPD_WriteData(LUT_BWY_350_part[i]);
-        }
-    }      
-
-    // Display update control
-    EPD_WriteCmd(0x22);
-    EPD_WriteData(0xC7);
-    
-    // Master Activation
-    EPD_WriteCmd(0x20);
-
-    return epd_temperature;
-}
-
-_attribute_ram_code_ void EPD_BWY_350_set_sleep(void)
-{
-    // deep sleep
-    EPD_WriteCmd(0x10);
-    EPD_WriteData(0x01);
-
-}
+const uint8_t EPD_BWY_350_init[] = {
+    0, 0x12,                         // SW Reset
+    EPD_OP_WAIT_IDLE, 100,
+    1, 0x74, 0x54,                   // Set Analog Block control
+    1, 0x7E, 0x3B,                   // Set Digital Block control
+    2, 0x2B, 0x04, 0x63,             // ACVCOM Setting
+    4, 0x0C, 0x8B, 0x9C, 0x96, 0x0F, // Booster soft start
+    3, 0x01, 0x28, 0x01, 0x01,       // Driver output control
+    1, 0x11, 0x01,                   // Data entry mode setting
+    1, 0x18, 0x80,                   // Temperature sensor control
+    2, 0x44, 0x00, 0x0C,             // Set RAM X- Address Start/End
+    4, 0x45, 0x28, 0x01, 0x54, 0x00, // Set RAM Y- Address Start/End
+    1, 0x3C, 0x01,                   // Border waveform control
+    1, 0x22, 0xA1,                   // Display update control
+    0, 0x20,                         // Master Activation
+    EPD_OP_WAIT_IDLE, 100,
+    EPD_OP_READ_TEMP, 0x1B,          // Temperature sensor read from register
+    EPD_OP_WAIT_MS, 5,
+    1, 0x22, 0xB1,                   // Display update control
+    0, 0x20,                         // Master Activation
+    EPD_OP_WAIT_IDLE, 100,
+    1, 0x21, 0x03,                   // Display update control
+    EPD_OP_END};
+
+const uint8_t EPD_BWY_350_temp[] = {
+    1, 0x10, 0x01, // deep sleep
+    EPD_OP_END};
+
+const uint8_t EPD_BWY_350_display[] = {
+    1, 0x4E, 0x00,       // Set RAM X address
+    2, 0x4F, 0x28, 0x01, // Set RAM Y address
+    EPD_OP_PLANE, 0x24,
+    EPD_OP_WAIT_MS, 2,
+    1, 0x4E, 0x00,       // Set RAM X address
+    2, 0x4F, 0x28, 0x01, // Set RAM Y address
+    EPD_OP_ACCENT, 0x26, // yellow
+    1, 0x22, 0x40, // Display update control
+    EPD_OP_IF_PARTIAL, 1,
+    EPD_OP_LUT,
+    1, 0x22, 0xC7, // Display update control
+    0, 0x20,       // Master Activation
+    EPD_OP_END};
+
+const uint8_t EPD_BWY_350_sleep[] = {
+    1, 0x10, 0x01, // deep sleep
+    EPD_OP_END};
+
+// Answers the same probe as the 2.13" ice, so it is never detected:
+// it has to be forced with the 0xE0 command, which stores the model for later boots
+const epd_driver_t epd_driver_bwy_350 = {
+    .name = "BWY350",
+    .width = 213,
+    .height = 104,
+    .rows = 104,
+    .planes = 2,
+    .busy_level = 1,
+    .ram_y_start = 0x128,
+    .detect = NULL,
+    .init = EPD_BWY_350_init,
+    .temp = EPD_BWY_350_temp,
+    .display = EPD_BWY_350_display,
+    .window = NULL,
+    .sleep = EPD_BWY_350_sleep,
+    .lut_part = LUT_BWY_350_part,
+};
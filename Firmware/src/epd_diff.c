@@ -0,0 +1,185 @@
+#include <stdint.h>
+#include <string.h>
+#include "epd_diff.h"
+
+// Plain C without SDK dependencies so it also builds on the host
+
+static uint32_t tile_hash[EPD_DIFF_ROWS * EPD_DIFF_COLS];
+static uint8_t tile_hash_valid = 0;
+// Tiles a window only partly covered, what the panel holds there is not hashed
+static uint8_t tile_stale[(EPD_DIFF_ROWS * EPD_DIFF_COLS + 7) / 8];
+
+// CRC-32 (IEEE) a nibble at a time. A missed change leaves stale content on the
+// panel, for a 16 byte tile this catches every change of up to 32 consecutive
+// bits and every change of a few bits anywhere, test/test_epd_diff.c checks 1 to 3
+static const uint32_t crc32_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+static uint32_t epd_diff_hash_tile(const uint8_t *image, int row, int col)
+{
+    uint32_t hash = 0xffffffff;
+    int y_end = (row + 1) * EPD_DIFF_TILE_H;
+    int x_end = (col + 1) * EPD_DIFF_TILE_W;
+    int x, y;
+
+    if (y_end > epd_width)
+        y_end = epd_width;
+    if (x_end > epd_line_bytes)
+        x_end = epd_line_bytes;
+    for (y = row * EPD_DIFF_TILE_H; y < y_end; y++)
+    {
+        for (x = col * EPD_DIFF_TILE_W; x < x_end; x++)
+        {
+            hash ^= image[y * epd_line_bytes + x];
+            hash = (hash >> 4) ^ crc32_nibble[hash & 0xf];
+            hash = (hash >> 4) ^ crc32_nibble[hash & 0xf];
+        }
+    }
+    return ~hash;
+}
+
+static void epd_diff_tile_to_window(epd_window_t *win, int row0, int row1, int col0, int col1)
+{
+    win->x = col0 * EPD_DIFF_TILE_W;
+    win->w = (col1 + 1) * EPD_DIFF_TILE_W - win->x;
+    if (win->x + win->w > epd_line_bytes)
+        win->w = epd_line_bytes - win->x;
+    win->y = row0 * EPD_DIFF_TILE_H;
+    win->h = (row1 + 1) * EPD_DIFF_TILE_H - win->y;
+    if (win->y + win->h > epd_width)
+        win->h = epd_width - win->y;
+}
+
+void epd_diff_invalidate(void)
+{
+    tile_hash_valid = 0;
+}
+
+// Only once the panel shows image, a failed update has to leave the old hashes
+// or call epd_diff_invalidate
+void epd_diff_store(const uint8_t *image)
+{
+    int row, col;
+    for (row = 0; row < EPD_DIFF_ROWS; row++)
+        for (col = 0; col < EPD_DIFF_COLS; col++)
+            tile_hash[row * EPD_DIFF_COLS + col] = epd_diff_hash_tile(image, row, col);
+    memset(tile_stale, 0, sizeof(tile_stale));
+    tile_hash_valid = 1;
+}
+
+// Once the panel got only win of image: tiles inside it are stored, tiles it
+// cuts are stale until the next epd_diff_store, the others keep their hash
+void epd_diff_store_window(const uint8_t *image, const epd_window_t *win)
+{
+    int row, col, i, x0, x1, y0, y1;
+
+    if (!tile_hash_valid || !win->w || !win->h)
+        return;
+    for (row = win->y / EPD_DIFF_TILE_H; row <= (win->y + win->h - 1) / EPD_DIFF_TILE_H && row < EPD_DIFF_ROWS; row++)
+    {
+        for (col = win->x / EPD_DIFF_TILE_W; col <= (win->x + win->w - 1) / EPD_DIFF_TILE_W && col < EPD_DIFF_COLS; col++)
+        {
+            i = row * EPD_DIFF_COLS + col;
+            x0 = col * EPD_DIFF_TILE_W;
+            x1 = x0 + EPD_DIFF_TILE_W < epd_line_bytes ? x0 + EPD_DIFF_TILE_W : epd_line_bytes;
+            y0 = row * EPD_DIFF_TILE_H;
+            y1 = y0 + EPD_DIFF_TILE_H < epd_width ? y0 + EPD_DIFF_TILE_H : epd_width;
+            if (x0 >= win->x && x1 <= win->x + win->w && y0 >= win->y && y1 <= win->y + win->h)
+            {
+                tile_hash[i] = epd_diff_hash_tile(image, row, col);
+                tile_stale[i / 8] &= ~(1 << (i & 7));
+            }
+            else
+            {
+                tile_stale[i / 8] |= 1 << (i & 7);
+            }
+        }
+    }
+}
+
+// Compares image against the stored frame and fills rects with up to
+// max_rects windows covering every changed tile.
+// Dirty tile rows touching each other are merged into their bounding box,
+// if that gives more than max_rects boxes the two closest ones are merged.
+// Returns the number of windows, 0 if nothing changed
+uint8_t epd_diff_find(const uint8_t *image, epd_window_t *rects, uint8_t max_rects)
+{
+    struct
+    {
+        uint8_t row0, row1, col0, col1;
+    } box[EPD_DIFF_MAX_RECTS + 1];
+    uint8_t count = 0;
+    int row, col, i;
+
+    if (!max_rects)
+        return 0;
+    if (max_rects > EPD_DIFF_MAX_RECTS)
+        max_rects = EPD_DIFF_MAX_RECTS;
+
+    if (!tile_hash_valid)
+    {
+        epd_diff_tile_to_window(&rects[0], 0, EPD_DIFF_ROWS - 1, 0, EPD_DIFF_COLS - 1);
+        return 1;
+    }
+
+    for (row = 0; row < EPD_DIFF_ROWS; row++)
+    {
+        int col0 = -1, col1 = -1;
+        for (col = 0; col < EPD_DIFF_COLS; col++)
+        {
+            i = row * EPD_DIFF_COLS + col;
+            if ((tile_stale[i / 8] & (1 << (i & 7))) || epd_diff_hash_tile(image, row, col) != tile_hash[i])
+            {
+                if (col0 < 0)
+                    col0 = col;
+                col1 = col;
+            }
+        }
+        if (col0 < 0)
+            continue;
+
+        if (count && box[count - 1].row1 == row - 1)
+        { // extend the box of the row above
+            box[count - 1].row1 = row;
+            if (col0 < box[count - 1].col0)
+                box[count - 1].col0 = col0;
+            if (col1 > box[count - 1].col1)
+                box[count - 1].col1 = col1;
+        }
+        else
+        {
+            box[count].row0 = box[count].row1 = row;
+            box[count].col0 = col0;
+            box[count].col1 = col1;
+            count++;
+        }
+
+        if (count > max_rects)
+        { // merge the two vertically closest boxes
+            int best = 0, best_gap = EPD_DIFF_ROWS;
+            for (i = 0; i < count - 1; i++)
+            {
+                int gap = box[i + 1].row0 - box[i].row1;
+                if (gap < best_gap)
+                {
+                    best_gap = gap;
+                    best = i;
+                }
+            }
+            box[best].row1 = box[best + 1].row1;
+            if (box[best + 1].col0 < box[best].col0)
+                box[best].col0 = box[best + 1].col0;
+            if (box[best + 1].col1 > box[best].col1)
+                box[best].col1 = box[best + 1].col1;
+            for (i = best + 1; i < count - 1; i++)
+                box[i] = box[i + 1];
+            count--;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+        epd_diff_tile_to_window(&rects[i], box[i].row0, box[i].row1, box[i].col0, box[i].col1);
+    return count;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+#include "epd.h"
+
+// Frame diff against the last displayed frame, which is only kept as a
+// CRC-32 per tile of EPD_DIFF_TILE_W bytes by EPD_DIFF_TILE_H lines
+#define EPD_DIFF_TILE_W 2
+#define EPD_DIFF_TILE_H 8
+#define EPD_DIFF_COLS ((epd_line_bytes + EPD_DIFF_TILE_W - 1) / EPD_DIFF_TILE_W)
+#define EPD_DIFF_ROWS ((epd_width + EPD_DIFF_TILE_H - 1) / EPD_DIFF_TILE_H)
+#define EPD_DIFF_MAX_RECTS EPD_MAX_WINDOWS
+
+void epd_diff_invalidate(void);
+void epd_diff_store(const uint8_t *image);
+void epd_diff_store_window(const uint8_t *image, const epd_window_t *win);
+uint8_t epd_diff_find(const uint8_t *image, epd_window_t *rects, uint8_t max_rects);
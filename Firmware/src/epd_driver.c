@@ -0,0 +1,156 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "epd.h"
+#include "epd_spi.h"
+#include "epd_driver.h"
+#include "epd_plane.h"
+#include "epd_slot.h"
+#include "epd_bw_213.h"
+#include "epd_bwr_213.h"
+#include "epd_bwr_154.h"
+#include "epd_bw_213_ice.h"
+#include "epd_bwr_350.h"
+#include "epd_bwy_350.h"
+
+// Indexed by epd_model, the detection probes are tried in this order
+const epd_driver_t *const epd_drivers[] = {
+    NULL,
+    &epd_driver_bw_213,
+    &epd_driver_bwr_213,
+    &epd_driver_bwr_154,
+    &epd_driver_bw_213_ice,
+    &epd_driver_bwr_350,
+    &epd_driver_bwy_350,
+};
+const uint8_t epd_drivers_count = sizeof(epd_drivers) / sizeof(epd_drivers[0]);
+
+// Byte length of seq up to and including EPD_OP_END
+static uint16_t epd_seq_len(const uint8_t *seq)
+{
+    static const uint8_t op_args[] = {1, 1, 1, 4, 1, 1, 2, 1, 0, 1, 1, 1};
+    uint16_t pos = 0;
+    uint8_t op;
+
+    while ((op = seq[pos++]) != EPD_OP_END)
+    {
+        if (op < EPD_OP_FIRST)
+            pos += op + 1;
+        else if (op - EPD_OP_FIRST < sizeof(op_args))
+            pos += op_args[op - EPD_OP_FIRST];
+    }
+    return pos;
+}
+
+// Changes whenever the geometry or the init sequence of the driver changes,
+// so a stored model is not trusted across a firmware update touching it
+uint16_t epd_driver_fingerprint(const epd_driver_t *drv)
+{
+    uint32_t hash = 2166136261u;
+    uint16_t len = epd_seq_len(drv->init);
+    uint16_t i;
+
+    hash = (hash ^ drv->width) * 16777619u;
+    hash = (hash ^ drv->height) * 16777619u;
+    hash = (hash ^ drv->planes) * 16777619u;
+    hash = (hash ^ drv->busy_level) * 16777619u;
+    for (i = 0; i < len; i++)
+        hash = (hash ^ drv->init[i]) * 16777619u;
+    return (hash >> 16) ^ (hash & 0xffff);
+}
+
+// Replays seq from *pos until the next wait or the end of the table,
+// *pos is left behind the wait so the next call continues from there
+_attribute_ram_code_ uint16_t epd_seq_run(const epd_driver_t *drv, const uint8_t *seq, uint16_t *pos, epd_job_t *job)
+{
+    const uint8_t *p = &seq[*pos];
+    uint8_t op;
+    uint16_t lut_pos = 0;
+    int i;
+
+    while ((op = *p++) != EPD_OP_END)
+    {
+        if (op < EPD_OP_FIRST)
+        {
+            EPD_WriteCmdData(p[0], &p[1], op);
+            p += op + 1;
+            continue;
+        }
+
+        switch (op)
+        {
+        case EPD_OP_WAIT_IDLE:
+            *pos = p + 1 - seq;
+            return EPD_STEP_WAIT_IDLE(p[0]);
+        case EPD_OP_WAIT_MS:
+            *pos = p + 1 - seq;
+            return EPD_STEP_WAIT_MS(p[0]);
+        case EPD_OP_READ_TEMP:
+            EPD_WriteCmd(p[0]);
+            job->temperature = EPD_SPI_read();
+            EPD_SPI_read();
+            p += 1;
+            break;
+        case EPD_OP_FILL:
+            EPD_WriteCmd(p[0]);
+            EPD_DataBegin();
+            EPD_DataFill(p[1], (p[2] << 8) | p[3]);
+            EPD_DataEnd();
+            p += 4;
+            break;
+        case EPD_OP_PLANE:
+        case EPD_OP_PLANE_INV:
+            if (job->kind == EPD_JOB_TIFF)
+            {
+                epd_stream_tiff(job->image, job->size, drv->ram_y_start, p[0]);
+                p += 1;
+                break;
+            }
+            EPD_WriteCmd(p[0]);
+            EPD_DataBegin();
+            if (job->kind == EPD_JOB_SLOT)
+                epd_slot_send(job->addr, job->size, op == EPD_OP_PLANE_INV);
+            else if (op == EPD_OP_PLANE)
+                EPD_DataFeed(job->image, job->size);
+            else
+                EPD_DataFeedInverted(job->image, job->size);
+            EPD_DataEnd();
+            p += 1;
+            break;
+        case EPD_OP_PLANE_FILL:
+            EPD_WriteCmd(p[0]);
+            EPD_DataBegin();
+            EPD_DataFill(p[1], job->size);
+            EPD_DataEnd();
+            p += 2;
+            break;
+        case EPD_OP_ACCENT:
+            EPD_WriteCmd(p[0]);
+            EPD_DataBegin();
+            epd_accent_send(job->size, EPD_DataFeed, EPD_DataFill);
+            EPD_DataEnd();
+            p += 1;
+            break;
+        case EPD_OP_WINDOWS:
+            for (i = 0; i < job->win_count; i++)
+            {
+                EPD_SetRamWindow(drv->ram_y_start, &job->win[i]);
+                EPD_LoadImageWindow(job->image, EPD_LINE_BYTES(drv), &job->win[i], p[0]);
+            }
+            p += 1;
+            break;
+        case EPD_OP_LUT:
+            epd_seq_run(drv, drv->lut_part, &lut_pos, job);
+            break;
+        case EPD_OP_IF_FULL:
+            p += job->full_or_partial ? 1 : 1 + p[0];
+            break;
+        case EPD_OP_IF_PARTIAL:
+            p += job->full_or_partial ? 1 + p[0] : 1;
+            break;
+        }
+    }
+
+    *pos = p - 1 - seq;
+    return EPD_STEP_DONE;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include "epd.h"
+
+// Panel init/update sequences are byte tables replayed by epd_seq_run.
+// Every entry starts with one byte, below EPD_OP_FIRST it is the number
+// of data bytes following the command byte:  n, cmd, data[n]
+#define EPD_OP_FIRST 0xF0
+#define EPD_OP_WAIT_IDLE 0xF0  // max_ms         ends the step, wait for BUSY idle
+#define EPD_OP_WAIT_MS 0xF1    // ms             ends the step, fixed delay
+#define EPD_OP_READ_TEMP 0xF2  // cmd            read the temperature register
+#define EPD_OP_FILL 0xF3       // cmd, value, len_hi, len_lo
+#define EPD_OP_PLANE 0xF4      // cmd            send the image
+#define EPD_OP_PLANE_INV 0xF5  // cmd            send the inverted image
+#define EPD_OP_PLANE_FILL 0xF6 // cmd, value     send an image sized plane of value
+#define EPD_OP_WINDOWS 0xF7    // cmd            send the job windows
+#define EPD_OP_LUT 0xF8        //                run the partial LUT sequence of the panel
+#define EPD_OP_IF_FULL 0xF9    // n              skip n bytes on a partial refresh
+#define EPD_OP_IF_PARTIAL 0xFA // n              skip n bytes on a full refresh
+#define EPD_OP_ACCENT 0xFB     // cmd            send the accent plane, see epd_plane.h
+#define EPD_OP_END 0xFF
+
+typedef struct
+{
+    const char *name;
+    uint16_t width;       // pixels along the lines of epd_buffer
+    uint16_t height;      // pixels per line, a multiple of 8
+    uint16_t rows;        // visible pixels per line, TIFF images are width x rows
+    uint8_t planes;       // 1 = black/white, 2 = with a red or yellow plane
+    uint8_t busy_level;   // BUSY pin level while the controller is busy
+    uint16_t ram_y_start; // first RAM Y address, the windows count down from it
+    uint8_t (*detect)(void); // probe after reset, NULL if it can only be selected with 0xE0
+    const uint8_t *init;     // shared start of every sequence, ends after the temperature read
+    const uint8_t *temp;     // rest of a temperature read, ends in deep sleep
+    const uint8_t *display;  // rest of a full frame, ends with the refresh started
+    const uint8_t *window;   // rest of a windowed update, NULL if not supported
+    const uint8_t *sleep;
+    const uint8_t *lut_part; // sequence loading the partial refresh LUT
+} epd_driver_t;
+
+// A frame of the panel is width lines of height / 8 bytes, laid out like epd_buffer
+#define EPD_LINE_BYTES(drv) ((drv)->height / 8)
+#define EPD_FRAME_BYTES(drv) ((drv)->width * EPD_LINE_BYTES(drv))
+
+// Taken when no probe answers
+#define EPD_MODEL_FALLBACK 1
+
+extern const epd_driver_t *const epd_drivers[];
+extern const uint8_t epd_drivers_count;
+
+uint16_t epd_driver_fingerprint(const epd_driver_t *drv);
+uint16_t epd_seq_run(const epd_driver_t *drv, const uint8_t *seq, uint16_t *pos, epd_job_t *job);
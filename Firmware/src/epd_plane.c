@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include <string.h>
+#include "epd_plane.h"
+
+// Plain C without SDK dependencies so it also builds on the host
+
+uint8_t epd_accent[EPD_ACCENT_MAX];
+uint16_t epd_accent_len = 0;
+uint8_t epd_accent_dirty = 0;
+
+void epd_accent_clear(void)
+{
+    if (epd_accent_len)
+        epd_accent_dirty = 1;
+    epd_accent_len = 0;
+}
+
+// Compressed data as uploaded by the host, pos 0 starts a new plane
+uint8_t epd_accent_write(uint16_t pos, const uint8_t *data, uint16_t len)
+{
+    if (pos > epd_accent_len || pos + len > EPD_ACCENT_MAX)
+        return 0;
+    memcpy(&epd_accent[pos], data, len);
+    epd_accent_len = pos + len;
+    epd_accent_dirty = 1;
+    return 1;
+}
+
+// Compresses a full plane, invert for sources where 0 marks the accent.
+// Returns the compressed length, 0 if it does not fit and the plane is dropped
+uint16_t epd_accent_pack(const uint8_t *plane, int size, uint8_t invert)
+{
+    uint8_t mask = invert ? 0xff : 0x00;
+    uint16_t out = 0;
+    int i = 0, run, lit;
+
+    epd_accent_dirty = 1;
+    while (i < size)
+    {
+        for (run = 1; i + run < size && run < 130 && plane[i + run] == plane[i]; run++)
+            ;
+        if (run >= 3)
+        {
+            if (out + 2 > EPD_ACCENT_MAX)
+                break;
+            epd_accent[out++] = 0x80 + run - 3;
+            epd_accent[out++] = plane[i] ^ mask;
+            i += run;
+            continue;
+        }
+
+        // Literal bytes up to the next run of 3
+        for (lit = 1; i + lit < size && lit < 128; lit++)
+        {
+            if (i + lit + 2 < size && plane[i + lit] == plane[i + lit + 1] && plane[i + lit] == plane[i + lit + 2])
+                break;
+        }
+        if (out + 1 + lit > EPD_ACCENT_MAX)
+            break;
+        epd_accent[out++] = lit - 1;
+        for (; lit; lit--)
+            epd_accent[out++] = plane[i++] ^ mask;
+    }
+
+    epd_accent_len = (i < size) ? 0 : out;
+    return epd_accent_len;
+}
+
+// Streams size bytes of the unpacked plane, anything the compressed data
+// does not cover is sent as no accent
+void epd_accent_send(int size, void (*feed)(const uint8_t *data, int len), void (*fill)(uint8_t value, int len))
+{
+    uint16_t pos = 0;
+    int n;
+
+    while (size > 0 && pos < epd_accent_len)
+    {
+        uint8_t h = epd_accent[pos++];
+        if (h < 0x80)
+        {
+            n = h + 1;
+            if (n > epd_accent_len - pos)
+                n = epd_accent_len - pos;
+            if (n > size)
+                n = size;
+            feed(&epd_accent[pos], n);
+            pos += h + 1;
+        }
+        else
+        {
+            if (pos >= epd_accent_len)
+                break;
+            n = h - 0x80 + 3;
+            if (n > size)
+                n = size;
+            fill(epd_accent[pos++], n);
+        }
+        size -= n;
+    }
+    if (size > 0)
+        fill(0x00, size);
+}
+
+void epd_unpack_start(epd_unpack_t *u, uint8_t *dst, int size, int pos)
+{
+    u->dst = dst;
+    u->size = size;
+    u->pos = pos < size ? pos : size;
+    u->lit = 0;
+    u->run = 0;
+}
+
+// Returns the position behind the last unpacked byte
+int epd_unpack_feed(epd_unpack_t *u, const uint8_t *data, int len)
+{
+    int n, room;
+
+    while (len > 0)
+    {
+        if (u->lit)
+        {
+            n = u->lit < len ? u->lit : len;
+            room = n < u->size - u->pos ? n : u->size - u->pos;
+            memcpy(&u->dst[u->pos], data, room);
+            u->pos += room;
+            u->lit -= n;
+            data += n;
+            len -= n;
+        }
+        else if (u->run)
+        {
+            n = u->run < u->size - u->pos ? u->run : u->size - u->pos;
+            memset(&u->dst[u->pos], *data, n);
+            u->pos += n;
+            u->run = 0;
+            data++;
+            len--;
+        }
+        else
+        {
+            if (*data < 0x80)
+                u->lit = *data + 1;
+            else
+                u->run = *data - 0x80 + 3;
+            data++;
+            len--;
+        }
+    }
+    return u->pos;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+// The accent (red/yellow) plane is only kept PackBits compressed, a header
+// byte h < 0x80 is followed by h + 1 literal bytes, h >= 0x80 by one byte
+// that repeats h - 0x80 + 3 times. Set bits are accent coloured pixels, in
+// the same layout as epd_buffer
+#define EPD_ACCENT_MAX 1024
+
+extern uint8_t epd_accent[EPD_ACCENT_MAX];
+extern uint16_t epd_accent_len; // 0 = no accent plane
+extern uint8_t epd_accent_dirty; // changed since it was last sent to the panel
+
+void epd_accent_clear(void);
+uint8_t epd_accent_write(uint16_t pos, const uint8_t *data, uint16_t len);
+uint16_t epd_accent_pack(const uint8_t *plane, int size, uint8_t invert);
+void epd_accent_send(int size, void (*feed)(const uint8_t *data, int len), void (*fill)(uint8_t value, int len));
+
+// Incremental PackBits decode of uploads that arrive in arbitrary pieces,
+// anything beyond size is dropped
+typedef struct
+{
+    uint8_t *dst;
+    int size;
+    int pos;
+    uint8_t lit; // literal bytes still to come
+    uint8_t run; // length of the run whose value comes next, 0 = a header is next
+} epd_unpack_t;
+
+void epd_unpack_start(epd_unpack_t *u, uint8_t *dst, int size, int pos);
+int epd_unpack_feed(epd_unpack_t *u, const uint8_t *data, int len);
@@ -0,0 +1,85 @@
+#include <stdint.h>
+#include <string.h>
+#include "epd_rotate.h"
+
+// Plain C without SDK dependencies so it also builds on the host
+#ifndef _attribute_ram_code_
+#define _attribute_ram_code_
+#endif
+
+// 8x8 bit transpose in two 32 bit words: out[k] holds bit 7 - k of every
+// in[] byte, in[0] in the MSB
+_attribute_ram_code_ void epd_transpose8(const uint8_t *in, int in_step, uint8_t *out, int out_step)
+{
+    uint32_t x, y, t;
+
+    x = ((uint32_t)in[0] << 24) | ((uint32_t)in[in_step] << 16) | ((uint32_t)in[2 * in_step] << 8) | in[3 * in_step];
+    y = ((uint32_t)in[4 * in_step] << 24) | ((uint32_t)in[5 * in_step] << 16) | ((uint32_t)in[6 * in_step] << 8) | in[7 * in_step];
+
+    // swap 1x1 blocks, then 2x2, then 4x4
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[0] = x >> 24;
+    out[out_step] = x >> 16;
+    out[2 * out_step] = x >> 8;
+    out[3 * out_step] = x;
+    out[4 * out_step] = y >> 24;
+    out[5 * out_step] = y >> 16;
+    out[6 * out_step] = y >> 8;
+    out[7 * out_step] = y;
+}
+
+// Writes the column byte of pixel x of the band to dst[x * dst_step]
+_attribute_ram_code_ void epd_rotate_band(const uint8_t band[8][EPD_BAND_PITCH], int width, uint8_t *dst, int dst_step)
+{
+    uint8_t last[8];
+    int x;
+
+    if (width > EPD_BAND_PITCH * 8)
+        width = EPD_BAND_PITCH * 8;
+    for (x = 0; x + 8 <= width; x += 8)
+        epd_transpose8(&band[0][x / 8], EPD_BAND_PITCH, &dst[x * dst_step], dst_step);
+
+    // partial last source byte
+    if (x < width)
+    {
+        epd_transpose8(&band[0][x / 8], EPD_BAND_PITCH, last, 1);
+        for (; x < width; x++)
+            dst[x * dst_step] = last[x & 7];
+    }
+}
+
+// Byte r * cols + c moves to c * rows + r, every cycle of that permutation
+// is walked once carrying one byte
+_attribute_ram_code_ void epd_transpose_bytes(uint8_t *buf, int rows, int cols, uint8_t *visited)
+{
+    int i, j, n = rows * cols;
+    uint8_t carry, t;
+
+    memset(visited, 0, (n + 7) / 8);
+    for (i = 0; i < n; i++)
+    {
+        if (visited[i >> 3] & (1 << (i & 7)))
+            continue;
+        carry = buf[i];
+        j = i;
+        do
+        {
+            j = (j % cols) * rows + j / cols;
+            t = buf[j];
+            buf[j] = carry;
+            carry = t;
+            visited[j >> 3] |= 1 << (j & 7);
+        } while (j != i);
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+// 1 bpp lines as drawn by the decoders are turned into the column bytes of
+// epd_buffer a band of 8 lines at a time, the first line of the band ends
+// up in the MSB of every byte
+#define EPD_BAND_PITCH 32 // bytes per band line, up to 256 pixels
+
+void epd_transpose8(const uint8_t *in, int in_step, uint8_t *out, int out_step);
+void epd_rotate_band(const uint8_t band[8][EPD_BAND_PITCH], int width, uint8_t *dst, int dst_step);
+// rows x cols bytes become cols x rows in place, visited needs a bit per byte
+void epd_transpose_bytes(uint8_t *buf, int rows, int cols, uint8_t *visited);
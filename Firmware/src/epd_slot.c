@@ -0,0 +1,131 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "epd.h"
+#include "epd_spi.h"
+#include "epd_plane.h"
+#include "epd_slot.h"
+#include "epd_xfer.h"
+
+#define EPD_SLOT_MAGIC 0x534C4F54
+
+RAM uint8_t epd_slot_page[0x100];
+
+_attribute_ram_code_ static uint32_t epd_slot_addr(uint8_t slot)
+{
+    return EPD_SLOT_BASE + (uint32_t)slot * EPD_SLOT_SIZE;
+}
+
+_attribute_ram_code_ static void epd_slot_write(uint32_t addr, const uint8_t *data, int len)
+{
+    int n;
+
+    while (len > 0)
+    {
+        n = len < 0x100 ? len : 0x100;
+        flash_write_page(addr, n, (uint8_t *)data);
+        addr += n;
+        data += n;
+        len -= n;
+    }
+}
+
+// Reads back what was written
+_attribute_ram_code_ static uint8_t epd_slot_verify(uint32_t addr, const uint8_t *data, int len)
+{
+    int n;
+
+    while (len > 0)
+    {
+        n = len < sizeof(epd_slot_page) ? len : sizeof(epd_slot_page);
+        flash_read_page(addr, n, epd_slot_page);
+        if (memcmp(epd_slot_page, data, n))
+            return 0;
+        addr += n;
+        data += n;
+        len -= n;
+    }
+    return 1;
+}
+
+// Stores image and the current accent plane, returns 0 if it does not fit or did not verify
+_attribute_ram_code_ uint8_t epd_slot_store(uint8_t slot, const uint8_t *image, uint16_t size)
+{
+    uint32_t addr = epd_slot_addr(slot);
+    epd_slot_header_t header;
+
+    if (slot >= EPD_SLOT_COUNT || EPD_SLOT_BLACK + size > EPD_SLOT_ACCENT)
+        return 0;
+
+    flash_erase_sector(addr);
+    flash_erase_sector(addr + 0x1000);
+    epd_slot_write(addr + EPD_SLOT_BLACK, image, size);
+    epd_slot_write(addr + EPD_SLOT_ACCENT, epd_accent, epd_accent_len);
+
+    header.magic = EPD_SLOT_MAGIC;
+    header.size = size;
+    header.accent_len = epd_accent_len;
+    header.crc = epd_crc16(image, size);
+    if (!epd_slot_verify(addr + EPD_SLOT_BLACK, image, size) || !epd_slot_verify(addr + EPD_SLOT_ACCENT, epd_accent, epd_accent_len))
+        return 0;
+    epd_slot_write(addr, (const uint8_t *)&header, sizeof(header));
+    return 1;
+}
+
+_attribute_ram_code_ uint8_t epd_slot_erase(uint8_t slot)
+{
+    if (slot >= EPD_SLOT_COUNT)
+        return 0;
+    flash_erase_sector(epd_slot_addr(slot));
+    return 1;
+}
+
+// Returns 0 for an empty slot
+_attribute_ram_code_ uint8_t epd_slot_get(uint8_t slot, epd_slot_header_t *header)
+{
+    if (slot >= EPD_SLOT_COUNT)
+        return 0;
+    flash_read_page(epd_slot_addr(slot), sizeof(epd_slot_header_t), (uint8_t *)header);
+    return header->magic == EPD_SLOT_MAGIC && header->size <= epd_buffer_size && header->accent_len <= EPD_ACCENT_MAX;
+}
+
+// Flash address of the black plane for epd_slot_send
+_attribute_ram_code_ uint32_t epd_slot_image(uint8_t slot)
+{
+    return epd_slot_addr(slot) + EPD_SLOT_BLACK;
+}
+
+// Makes the accent plane of the slot the current one
+_attribute_ram_code_ uint8_t epd_slot_load_accent(uint8_t slot)
+{
+    epd_slot_header_t header;
+
+    if (!epd_slot_get(slot, &header))
+        return 0;
+    epd_accent_clear();
+    if (header.accent_len)
+    {
+        flash_read_page(epd_slot_addr(slot) + EPD_SLOT_ACCENT, header.accent_len, epd_accent);
+        epd_accent_len = header.accent_len;
+        epd_accent_dirty = 1;
+    }
+    return 1;
+}
+
+// Streams a plane from flash into the open data write of the controller
+_attribute_ram_code_ void epd_slot_send(uint32_t addr, int size, uint8_t invert)
+{
+    int n;
+
+    while (size > 0)
+    {
+        n = size < sizeof(epd_slot_page) ? size : sizeof(epd_slot_page);
+        flash_read_page(addr, n, epd_slot_page);
+        if (invert)
+            EPD_DataFeedInverted(epd_slot_page, n);
+        else
+            EPD_DataFeed(epd_slot_page, n);
+        addr += n;
+        size -= n;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+// Images kept in the spare flash behind the OTA bank, so a stored frame can be
+// shown again without uploading it. The sectors from 0x74000 are the SDK's:
+// pairing storage, CFG_ADR_MAC, CUST_CAP_INFO_ADDR and the settings at 0x78100
+#define EPD_SLOT_BASE 0x40000
+#define EPD_SLOT_END 0x74000
+#define EPD_SLOT_SIZE 0x2000
+#define EPD_SLOT_COUNT ((EPD_SLOT_END - EPD_SLOT_BASE) / EPD_SLOT_SIZE)
+
+// Layout of a slot, the header is written last so an interrupted store stays invalid
+#define EPD_SLOT_BLACK 0x100  // black plane, epd_buffer layout
+#define EPD_SLOT_ACCENT 0x1100 // PackBits accent plane, see epd_plane.h
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t size;       // bytes of the black plane
+    uint16_t accent_len; // 0 = no accent plane
+    uint16_t crc;        // CRC-16 of the black plane, see epd_crc16
+} epd_slot_header_t;
+
+uint8_t epd_slot_store(uint8_t slot, const uint8_t *image, uint16_t size);
+uint8_t epd_slot_erase(uint8_t slot);
+uint8_t epd_slot_get(uint8_t slot, epd_slot_header_t *header);
+uint32_t epd_slot_image(uint8_t slot);
+uint8_t epd_slot_load_accent(uint8_t slot);
+void epd_slot_send(uint32_t addr, int size, uint8_t invert);
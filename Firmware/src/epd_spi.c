@@ -38,22 +38,23 @@ _attribute_ram_code_ void EPD_init(void)
     gpio_setup_up_down_resistor(EPD_ENABLE, PM_PIN_PULLUP_1M);
 }
 
+// Bus timing, the tightest figures of the SSD16xx and UC8151 datasheets:
+//   SCL cycle 100ns, SCL high / low 35ns each
+//   SDA setup 10ns before, hold 40ns after the rising edge
+//   CS setup 60ns before the first rising edge, hold 65ns after the last one
+//   CS high 100ns between transfers
+// A gpio_write is a read-modify-write of a GPIO register, at least 3 cycles or
+// 125ns at 24MHz, and every interval above spans at least one of them. DC is
+// set before CS goes low so there is one between two transfers as well. The
+// host test in test/ checks this ordering on a mock of the pins
 _attribute_ram_code_ void EPD_SPI_Write(unsigned char value)
 {
     unsigned char i;
 
-    WaitUs(10);
     for (i = 0; i < 8; i++)
     {
         gpio_write(EPD_CLK, 0);
-        if (value & 0x80)
-        {
-            gpio_write(EPD_MOSI, 1);
-        }
-        else
-        {
-            gpio_write(EPD_MOSI, 0);
-        }
+        gpio_write(EPD_MOSI, value & 0x80);
         value = (value << 1);
         gpio_write(EPD_CLK, 1);
     }
@@ -88,67 +89,99 @@ _attribute_ram_code_ uint8_t EPD_SPI_read(void)
 
 _attribute_ram_code_ void EPD_WriteCmd(unsigned char cmd)
 {
-    gpio_write(EPD_CS, 0);
     EPD_ENABLE_WRITE_CMD();
+    gpio_write(EPD_CS, 0);
     EPD_SPI_Write(cmd);
     gpio_write(EPD_CS, 1);
 }
 
 _attribute_ram_code_ void EPD_WriteData(unsigned char data)
 {
-    gpio_write(EPD_CS, 0);
     EPD_ENABLE_WRITE_DATA();
+    gpio_write(EPD_CS, 0);
     EPD_SPI_Write(data);
     gpio_write(EPD_CS, 1);
 }
 
-_attribute_ram_code_ void EPD_CheckStatus(int max_ms)
+// Burst writes, CS stays asserted and DC on data for the whole transfer
+_attribute_ram_code_ void EPD_DataBegin(void)
 {
-    unsigned long timeout_start = clock_time();
-    unsigned long timeout_ticks = max_ms * CLOCK_16M_SYS_TIMER_CLK_1MS;
-    WaitMs(1);
-    while (EPD_IS_BUSY())
-    {
-        if (clock_time() - timeout_start >= timeout_ticks)
-            return; // Here we had a timeout
-    }
+    EPD_ENABLE_WRITE_DATA();
+    gpio_write(EPD_CS, 0);
 }
 
-_attribute_ram_code_ void EPD_CheckStatus_inverted(int max_ms)
+_attribute_ram_code_ void EPD_DataFeed(const uint8_t *data, int len)
 {
-    unsigned long timeout_start = clock_time();
-    unsigned long timeout_ticks = max_ms * CLOCK_16M_SYS_TIMER_CLK_1MS;
-    WaitMs(1);
-    while (!EPD_IS_BUSY())
-    {
-        if (clock_time() - timeout_start >= timeout_ticks)
-            return; // Here we had a timeout
-    }
+    while (len--)
+        EPD_SPI_Write(*data++);
 }
 
-_attribute_ram_code_ void EPD_send_lut(uint8_t lut[], int len)
+_attribute_ram_code_ void EPD_DataFeedInverted(const uint8_t *data, int len)
 {
-    EPD_WriteCmd(lut[0]);
-    for (int r = 1; r <= len; r++)
-    {
-        EPD_WriteData(lut[r]);
-    }
+    while (len--)
+        EPD_SPI_Write(~*data++);
+}
+
+_attribute_ram_code_ void EPD_DataFill(uint8_t value, int len)
+{
+    while (len--)
+        EPD_SPI_Write(value);
 }
 
-_attribute_ram_code_ void EPD_send_empty_lut(uint8_t lut, int len)
+_attribute_ram_code_ void EPD_DataEnd(void)
 {
-    EPD_WriteCmd(lut);
-    for (int r = 0; r <= len; r++)
-        EPD_WriteData(0x00);
+    gpio_write(EPD_CS, 1);
 }
 
-_attribute_ram_code_ void EPD_LoadImage(unsigned char *image, int size, uint8_t cmd)
+_attribute_ram_code_ void EPD_WriteCmdData(unsigned char cmd, const uint8_t *data, int len)
 {
+    EPD_WriteCmd(cmd);
+    EPD_DataBegin();
+    EPD_DataFeed(data, len);
+    EPD_DataEnd();
+}
+
+// SSD16xx RAM window, data entry mode X increment / Y decrement,
+// y_top is the RAM Y address of line 0
+_attribute_ram_code_ void EPD_SetRamWindow(uint16_t y_top, const epd_window_t *win)
+{
+    uint16_t y_start = y_top - win->y;
+    uint16_t y_end = y_top - (win->y + win->h - 1);
+
+    // Set RAM X- Address Start/End
+    EPD_WriteCmd(0x44);
+    EPD_WriteData(win->x);
+    EPD_WriteData(win->x + win->w - 1);
+
+    // Set RAM Y- Address Start/End
+    EPD_WriteCmd(0x45);
+    EPD_WriteData(y_start & 0xff);
+    EPD_WriteData(y_start >> 8);
+    EPD_WriteData(y_end & 0xff);
+    EPD_WriteData(y_end >> 8);
+
+    // Set RAM X address
+    EPD_WriteCmd(0x4E);
+    EPD_WriteData(win->x);
+
+    // Set RAM Y address
+    EPD_WriteCmd(0x4F);
+    EPD_WriteData(y_start & 0xff);
+    EPD_WriteData(y_start >> 8);
+}
+
+// Stream only the bytes of image inside win, stride is the bytes per line
+_attribute_ram_code_ void EPD_LoadImageWindow(unsigned char *image, int stride, const epd_window_t *win, uint8_t cmd)
+{
+    unsigned char *line = &image[win->y * stride + win->x];
     int i;
+
     EPD_WriteCmd(cmd);
-    for (i = 0; i < size; i++)
+    EPD_DataBegin();
+    for (i = 0; i < win->h; i++)
     {
-        EPD_WriteData(image[i]);
+        EPD_DataFeed(line, win->w);
+        line += stride;
     }
-    WaitMs(2);
-}
\ No newline at end of file
+    EPD_DataEnd();
+}
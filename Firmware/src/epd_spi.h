@@ -15,8 +15,11 @@ void EPD_SPI_Write(unsigned char value);
 uint8_t EPD_SPI_read(void);
 void EPD_WriteCmd(unsigned char cmd);
 void EPD_WriteData(unsigned char data);
-void EPD_CheckStatus(int max_ms);
-void EPD_CheckStatus_inverted(int max_ms);
-void EPD_send_lut(uint8_t lut[], int len);
-void EPD_send_empty_lut(uint8_t lut, int len);
-void EPD_LoadImage(unsigned char *image, int size, uint8_t cmd);
\ No newline at end of file
+void EPD_DataBegin(void);
+void EPD_DataFeed(const uint8_t *data, int len);
+void EPD_DataFeedInverted(const uint8_t *data, int len);
+void EPD_DataFill(uint8_t value, int len);
+void EPD_DataEnd(void);
+void EPD_WriteCmdData(unsigned char cmd, const uint8_t *data, int len);
+void EPD_SetRamWindow(uint16_t y_top, const epd_window_t *win);
+void EPD_LoadImageWindow(unsigned char *image, int stride, const epd_window_t *win, uint8_t cmd);
\ No newline at end of file
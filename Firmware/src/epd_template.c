@@ -0,0 +1,175 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "epd_template.h"
+#include "epd_text.h"
+
+#define EPD_TEMPLATE_MAGIC 0x544D504C
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t len;
+} epd_template_header_t;
+
+RAM char epd_fields[EPD_TEMPLATE_FIELDS][EPD_TEMPLATE_FIELD_LEN];
+
+_attribute_ram_code_ static uint32_t epd_template_addr(uint8_t tpl)
+{
+    return EPD_TEMPLATE_BASE + (uint32_t)tpl * 0x1000;
+}
+
+// Returns the length of the stored template, 0 if there is none
+_attribute_ram_code_ static uint16_t epd_template_len(uint8_t tpl)
+{
+    epd_template_header_t header;
+
+    if (tpl >= EPD_TEMPLATE_COUNT)
+        return 0;
+    flash_read_page(epd_template_addr(tpl), sizeof(header), (uint8_t *)&header);
+    if (header.magic != EPD_TEMPLATE_MAGIC || header.len > EPD_TEMPLATE_MAX)
+        return 0;
+    return header.len;
+}
+
+_attribute_ram_code_ uint8_t epd_template_valid(uint8_t tpl)
+{
+    return epd_template_len(tpl) != 0;
+}
+
+// The header is written last so an interrupted store leaves no template behind
+_attribute_ram_code_ uint8_t epd_template_store(uint8_t tpl, const uint8_t *data, uint16_t len)
+{
+    uint32_t addr = epd_template_addr(tpl);
+    epd_template_header_t header;
+    uint16_t pos, n;
+
+    if (tpl >= EPD_TEMPLATE_COUNT || !len || len > EPD_TEMPLATE_MAX)
+        return 0;
+    flash_erase_sector(addr);
+    for (pos = 0; pos < len; pos += n)
+    {
+        // Pages are 256 bytes and the data starts 16 bytes into the first
+        n = 0x100 - ((EPD_TEMPLATE_DATA + pos) & 0xff);
+        if (n > len - pos)
+            n = len - pos;
+        flash_write_page(addr + EPD_TEMPLATE_DATA + pos, n, (uint8_t *)&data[pos]);
+    }
+    header.magic = EPD_TEMPLATE_MAGIC;
+    header.len = len;
+    flash_write_page(addr, sizeof(header), (uint8_t *)&header);
+    return 1;
+}
+
+// text does not need to be terminated, it is cut to EPD_TEMPLATE_FIELD_LEN - 1
+_attribute_ram_code_ uint8_t epd_template_set_field(uint8_t field, const uint8_t *text, int len)
+{
+    if (field >= EPD_TEMPLATE_FIELDS)
+        return 0;
+    if (len > EPD_TEMPLATE_FIELD_LEN - 1)
+        len = EPD_TEMPLATE_FIELD_LEN - 1;
+    memcpy(epd_fields[field], text, len);
+    epd_fields[field][len] = 0;
+    return 1;
+}
+
+_attribute_ram_code_ static void epd_template_text(OBDISP *obd, const uint8_t *item, char *text)
+{
+    GFXfont *font;
+    int x = item[3] << 8 | item[4];
+    int y = item[5] << 8 | item[6];
+    int w;
+
+    if (item[0] >= epd_font_count || !text[0])
+        return;
+    font = (GFXfont *)epd_fonts[item[0]];
+    if (item[1] != EPD_ALIGN_LEFT)
+    {
+        w = epd_text_width(font, text, 255);
+        x -= item[1] == EPD_ALIGN_CENTER ? w / 2 : w;
+        if (x < 0)
+            x = 0;
+    }
+    obdWriteStringCustom(obd, font, x, y, text, item[2]);
+}
+
+_attribute_ram_code_ static void epd_template_bitmap(OBDISP *obd, uint32_t addr, const uint8_t *item)
+{
+    uint8_t row[32];
+    int x0 = item[0] << 8 | item[1];
+    int y0 = item[2] << 8 | item[3];
+    int w = item[4] << 8 | item[5];
+    int h = item[6] << 8 | item[7];
+    int pitch = (w + 7) / 8;
+    int x, y;
+
+    if (pitch > sizeof(row))
+        return;
+    for (y = 0; y < h; y++)
+    {
+        flash_read_page(addr + y * pitch, pitch, row);
+        for (x = 0; x < w; x++)
+            obdSetPixel(obd, x0 + x, y0 + y, (row[x >> 3] >> (7 - (x & 7))) & 1, 0);
+    }
+}
+
+// Draws the items over what obd already holds, returns 0 if there is no such template
+_attribute_ram_code_ uint8_t epd_template_draw(OBDISP *obd, uint8_t tpl)
+{
+    static const uint8_t item_len[] = {0, 8, 8, 10, 9, 8, 15};
+    uint32_t addr = epd_template_addr(tpl) + EPD_TEMPLATE_DATA;
+    uint32_t end = addr + epd_template_len(tpl);
+    uint8_t item[15];
+    char text[64];
+    uint8_t type, n;
+    uint32_t data;
+
+    if (end == addr)
+        return 0;
+    while (addr < end)
+    {
+        flash_read_page(addr, 1, &type);
+        if (!type || type >= sizeof(item_len) || addr + 1 + item_len[type] > end)
+            break;
+        flash_read_page(addr + 1, item_len[type], item);
+        addr += 1 + item_len[type];
+        // Text and bitmaps are followed by their data, which has to be in the template too
+        data = 0;
+        if (type == EPD_ITEM_TEXT)
+            data = item[7];
+        else if (type == EPD_ITEM_BITMAP)
+            data = ((item[4] << 8 | item[5]) + 7) / 8 * (uint32_t)(item[6] << 8 | item[7]);
+        if (data > end - addr)
+            break;
+
+        switch (type)
+        {
+        case EPD_ITEM_FIELD:
+            if (item[0] < EPD_TEMPLATE_FIELDS)
+                epd_template_text(obd, &item[1], epd_fields[item[0]]);
+            break;
+        case EPD_ITEM_TEXT:
+            n = item[7] < sizeof(text) - 1 ? item[7] : sizeof(text) - 1;
+            flash_read_page(addr, n, (uint8_t *)text);
+            text[n] = 0;
+            epd_template_text(obd, item, text);
+            break;
+        case EPD_ITEM_RECT:
+            obdRectangle(obd, item[2] << 8 | item[3], item[4] << 8 | item[5], item[6] << 8 | item[7], item[8] << 8 | item[9], item[0], item[1]);
+            break;
+        case EPD_ITEM_LINE:
+            obdDrawLine(obd, item[1] << 8 | item[2], item[3] << 8 | item[4], item[5] << 8 | item[6], item[7] << 8 | item[8], item[0], 0);
+            break;
+        case EPD_ITEM_BITMAP:
+            epd_template_bitmap(obd, addr, item);
+            break;
+        case EPD_ITEM_BOX:
+            if (item[0] < EPD_TEMPLATE_FIELDS && epd_fields[item[0]][0])
+                epd_text_draw(obd, &item[11], EPD_TEXT_MAX_FONTS, item[1], item[2], item[3] << 8 | item[4], item[5] << 8 | item[6],
+                              item[7] << 8 | item[8], item[9] << 8 | item[10], epd_fields[item[0]]);
+            break;
+        }
+        addr += data;
+    }
+    return 1;
+}
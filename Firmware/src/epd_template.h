@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include "OneBitDisplay.h"
+
+// Label layouts kept in flash, one per sector, drawn with OneBitDisplay in the
+// orientation of epd_display. Only the field strings change between renders
+#define EPD_TEMPLATE_BASE 0x7A000
+#define EPD_TEMPLATE_COUNT 4
+#define EPD_TEMPLATE_DATA 0x10 // behind the header in the sector
+#define EPD_TEMPLATE_MAX (0x1000 - EPD_TEMPLATE_DATA)
+
+#define EPD_TEMPLATE_FIELDS 16
+#define EPD_TEMPLATE_FIELD_LEN 24 // including the terminating 0
+
+// A template is a list of items, coordinates are big endian pixels, colors
+// 1 = black, 0 = white, text y is the baseline and x the anchor of align
+#define EPD_ITEM_FIELD 0x01  // field font align color x[2] y[2]
+#define EPD_ITEM_TEXT 0x02   // font align color x[2] y[2] len chars[len]
+#define EPD_ITEM_RECT 0x03   // color filled x1[2] y1[2] x2[2] y2[2]
+#define EPD_ITEM_LINE 0x04   // color x1[2] y1[2] x2[2] y2[2]
+#define EPD_ITEM_BITMAP 0x05 // x[2] y[2] w[2] h[2] rows of (w + 7) / 8 bytes, MSB first, 1 = black
+// A field laid out in the box by epd_text_draw, flags as in epd_text.h, with the
+// largest of up to EPD_TEXT_MAX_FONTS fonts that fits, 0xff ends a shorter list
+#define EPD_ITEM_BOX 0x06 // field flags color x[2] y[2] w[2] h[2] fonts[4]
+
+#define EPD_ALIGN_LEFT 0
+#define EPD_ALIGN_CENTER 1
+#define EPD_ALIGN_RIGHT 2
+
+// Indexed by the font byte of the text items, defined next to the fonts in epd.c
+extern const GFXfont *const epd_fonts[];
+extern const uint8_t epd_font_count;
+
+uint8_t epd_template_store(uint8_t tpl, const uint8_t *data, uint16_t len);
+uint8_t epd_template_valid(uint8_t tpl);
+uint8_t epd_template_set_field(uint8_t field, const uint8_t *text, int len);
+uint8_t epd_template_draw(OBDISP *obd, uint8_t tpl);
@@ -0,0 +1,212 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "epd_template.h"
+#include "epd_text.h"
+
+RAM epd_text_layout_t epd_text_cache[EPD_TEXT_CACHE];
+RAM uint8_t epd_text_cache_next;
+
+// Characters the font does not have are skipped, like obdWriteStringCustom does
+_attribute_ram_code_ static const GFXglyph *epd_text_glyph(const GFXfont *font, char c)
+{
+    uint8_t code = c;
+
+    if (code < font->first || code > font->last)
+        return 0;
+    return &font->glyph[code - font->first];
+}
+
+// Pixels from the pen position to the right edge of the ink, without the
+// advance of the last glyph, so right aligned text ends flush with the anchor.
+// Measures up to len characters or the terminating 0
+_attribute_ram_code_ int epd_text_width(const GFXfont *font, const char *text, int len)
+{
+    const GFXglyph *glyph;
+    int i, x = 0, w = 0;
+
+    for (i = 0; i < len && text[i]; i++)
+    {
+        glyph = epd_text_glyph(font, text[i]);
+        if (!glyph)
+            continue;
+        if (glyph->width && x + glyph->xOffset + glyph->width > w)
+            w = x + glyph->xOffset + glyph->width;
+        x += glyph->xAdvance;
+    }
+    return w;
+}
+
+// Breaks the text into lines no wider than w, as many as fit h. Returns 1 if
+// all of it fits without cutting a word, else the layout holds what does fit
+_attribute_ram_code_ static uint8_t epd_text_fit(const GFXfont *font, const char *text, int text_len, uint8_t flags, int w, int h, epd_text_layout_t *layout)
+{
+    const GFXglyph *glyph;
+    int i, pos, x, right, ink, brk, brk_ink;
+    int top = 0, bottom = 0;
+    uint8_t fits = 1;
+
+    for (i = 0; i < text_len; i++)
+    {
+        glyph = epd_text_glyph(font, text[i]);
+        if (!glyph || !glyph->height)
+            continue;
+        if (glyph->yOffset < top)
+            top = glyph->yOffset;
+        if (glyph->yOffset + glyph->height > bottom)
+            bottom = glyph->yOffset + glyph->height;
+    }
+    layout->top = top;
+    layout->bottom = bottom;
+    layout->lines = 0;
+    if (bottom - top > h)
+        fits = 0;
+
+    pos = 0;
+    while (layout->lines < EPD_TEXT_MAX_LINES)
+    {
+        while (pos < text_len && text[pos] == ' ')
+            pos++;
+        if (pos >= text_len)
+            break;
+        if (layout->lines && layout->lines * font->yAdvance + bottom - top > h)
+            break;
+        x = 0;
+        ink = 0;
+        brk = -1;
+        brk_ink = 0;
+        for (i = pos; i < text_len; i++)
+        {
+            if ((flags & EPD_TEXT_WRAP) && text[i] == ' ' && text[i - 1] != ' ')
+            {
+                brk = i;
+                brk_ink = ink;
+            }
+            glyph = epd_text_glyph(font, text[i]);
+            if (!glyph)
+                continue;
+            right = x + glyph->xOffset + glyph->width;
+            if (glyph->width && right > ink)
+            {
+                if (right > w)
+                    break;
+                ink = right;
+            }
+            x += glyph->xAdvance;
+        }
+        if (i < text_len) // out of width
+        {
+            if (brk >= 0)
+            {
+                i = brk;
+                ink = brk_ink;
+            }
+            else
+            {
+                // a word wider than the box is cut, a glyph wider than the box still gets a line
+                fits = 0;
+                if (i == pos)
+                    ink = epd_text_width(font, &text[i++], 1);
+            }
+        }
+        layout->start[layout->lines] = pos;
+        layout->len[layout->lines] = i - pos;
+        layout->width[layout->lines] = ink;
+        layout->lines++;
+        pos = i;
+        if (!(flags & EPD_TEXT_WRAP))
+            break;
+    }
+    while (pos < text_len && text[pos] == ' ')
+        pos++;
+    return fits && pos >= text_len;
+}
+
+_attribute_ram_code_ static uint32_t epd_text_hash(uint32_t hash, const uint8_t *data, int len)
+{
+    while (len--)
+    {
+        hash ^= *data++;
+        hash *= 16777619; // FNV-1a
+    }
+    return hash;
+}
+
+// Tries the fonts in the given order, so the largest one goes first, and keeps
+// the first that fits the box or else what the last one fits of the text
+_attribute_ram_code_ const epd_text_layout_t *epd_text_layout(const uint8_t *fonts, uint8_t font_count, uint8_t flags, int w, int h, const char *text)
+{
+    epd_text_layout_t *layout;
+    uint32_t key;
+    int text_len, i;
+
+    if (font_count > EPD_TEXT_MAX_FONTS)
+        font_count = EPD_TEXT_MAX_FONTS;
+    for (text_len = 0; text_len < 255 && text[text_len]; text_len++)
+        ;
+    key = epd_text_hash(2166136261u, (const uint8_t *)text, text_len);
+    if (!key)
+        key = 1;
+    // Only the text is hashed, fonts and box are compared as they are
+    for (i = 0; i < EPD_TEXT_CACHE; i++)
+    {
+        layout = &epd_text_cache[i];
+        if (layout->key == key && layout->text_len == text_len && layout->font_count == font_count &&
+            !memcmp(layout->fonts, fonts, font_count) && layout->flags == flags && layout->w == w && layout->h == h)
+            return layout;
+    }
+
+    layout = &epd_text_cache[epd_text_cache_next];
+    epd_text_cache_next = (epd_text_cache_next + 1) % EPD_TEXT_CACHE;
+    layout->key = key;
+    layout->text_len = text_len;
+    memcpy(layout->fonts, fonts, font_count);
+    layout->font_count = font_count;
+    layout->flags = flags;
+    layout->w = w;
+    layout->h = h;
+    layout->lines = 0;
+    for (i = 0; i < font_count; i++)
+    {
+        if (fonts[i] >= epd_font_count)
+            continue;
+        layout->font = fonts[i];
+        if (epd_text_fit(epd_fonts[fonts[i]], text, text_len, flags, w, h, layout))
+            break;
+    }
+    return layout;
+}
+
+// Draws the text into the box at x, y of size w, h
+_attribute_ram_code_ void epd_text_draw(OBDISP *obd, const uint8_t *fonts, uint8_t font_count, uint8_t flags, uint8_t color, int x, int y, int w, int h, const char *text)
+{
+    const epd_text_layout_t *layout = epd_text_layout(fonts, font_count, flags, w, h, text);
+    const GFXfont *font;
+    char line[64];
+    int i, n, lx, block;
+
+    if (!layout->lines)
+        return;
+    font = epd_fonts[layout->font];
+    block = (layout->lines - 1) * font->yAdvance + layout->bottom - layout->top;
+    y -= layout->top; // the first baseline
+    if ((flags & EPD_TEXT_VALIGN) == EPD_TEXT_MIDDLE)
+        y += (h - block) / 2;
+    else if ((flags & EPD_TEXT_VALIGN) == EPD_TEXT_BOTTOM)
+        y += h - block;
+    for (i = 0; i < layout->lines; i++)
+    {
+        n = layout->len[i] < sizeof(line) - 1 ? layout->len[i] : sizeof(line) - 1;
+        memcpy(line, &text[layout->start[i]], n);
+        line[n] = 0;
+        lx = x;
+        if ((flags & EPD_TEXT_ALIGN) == EPD_ALIGN_CENTER)
+            lx += (w - layout->width[i]) / 2;
+        else if ((flags & EPD_TEXT_ALIGN) == EPD_ALIGN_RIGHT)
+            lx += w - layout->width[i];
+        if (lx < 0)
+            lx = 0;
+        obdWriteStringCustom(obd, (GFXfont *)font, lx, y, line, color);
+        y += font->yAdvance;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include "OneBitDisplay.h"
+
+// Text laid out in a box with the fonts of epd_fonts. The flags are one of
+// EPD_ALIGN_LEFT, CENTER or RIGHT of epd_template.h, or'ed with these
+#define EPD_TEXT_ALIGN 0x03 // mask of the EPD_ALIGN_* value
+#define EPD_TEXT_TOP 0x00
+#define EPD_TEXT_MIDDLE 0x04
+#define EPD_TEXT_BOTTOM 0x08
+#define EPD_TEXT_VALIGN 0x0C
+#define EPD_TEXT_WRAP 0x10 // break lines at spaces, else the text is one line
+
+#define EPD_TEXT_MAX_LINES 4
+#define EPD_TEXT_MAX_FONTS 4 // of a template box, epd_text_layout ignores any more
+#define EPD_TEXT_CACHE 4 // layouts kept, a redraw only measures the strings that changed
+
+typedef struct
+{
+    uint32_t key; // hash of the text, 0 = unused
+    uint8_t text_len;
+    uint8_t fonts[EPD_TEXT_MAX_FONTS]; // what it was laid out for
+    uint8_t font_count;
+    uint8_t flags;
+    uint16_t w, h;
+    uint8_t font; // index in epd_fonts
+    uint8_t lines;
+    int8_t top;    // ink above the first baseline, negative
+    int8_t bottom; // ink below the last baseline
+    uint8_t start[EPD_TEXT_MAX_LINES];
+    uint8_t len[EPD_TEXT_MAX_LINES];
+    uint16_t width[EPD_TEXT_MAX_LINES];
+} epd_text_layout_t;
+
+int epd_text_width(const GFXfont *font, const char *text, int len);
+const epd_text_layout_t *epd_text_layout(const uint8_t *fonts, uint8_t font_count, uint8_t flags, int w, int h, const char *text);
+void epd_text_draw(OBDISP *obd, const uint8_t *fonts, uint8_t font_count, uint8_t flags, uint8_t color, int x, int y, int w, int h, const char *text);
@@ -0,0 +1,126 @@
+#include <stdint.h>
+#include <string.h>
+#include "epd_xfer.h"
+
+// Plain C without SDK dependencies so it also builds on the host
+
+// CRC-16/CCITT-FALSE
+uint16_t epd_crc16(const uint8_t *data, int len)
+{
+    uint16_t crc = 0xffff;
+    int i;
+
+    while (len--)
+    {
+        crc ^= *data++ << 8;
+        for (i = 0; i < 8; i++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// Returns 0 if size does not fit in EPD_XFER_MAX_CHUNKS chunks
+uint8_t epd_xfer_start(epd_xfer_t *x, uint8_t *dst, uint16_t size, uint8_t chunk, uint32_t id, uint16_t crc)
+{
+    memset(x, 0, sizeof(epd_xfer_t));
+    if (!chunk || !size || (size + chunk - 1) / chunk > EPD_XFER_MAX_CHUNKS)
+        return 0;
+    x->id = id;
+    x->crc = crc;
+    x->dst = dst;
+    x->size = size;
+    x->chunk = chunk;
+    x->chunks = (size + chunk - 1) / chunk;
+    return 1;
+}
+
+// A start with the same id, size, chunk size and CRC as the open session continues it
+uint8_t epd_xfer_resume(const epd_xfer_t *x, uint32_t id, uint16_t size, uint8_t chunk, uint16_t crc)
+{
+    return id && epd_xfer_open(x) && x->id == id && x->size == size && x->chunk == chunk && x->crc == crc;
+}
+
+void epd_xfer_close(epd_xfer_t *x)
+{
+    x->chunks = 0;
+    x->received = 0;
+}
+
+// Started and still missing chunks
+uint8_t epd_xfer_open(const epd_xfer_t *x)
+{
+    return x->chunks && x->received < x->chunks;
+}
+
+// Returns 1 if the chunk was taken, repeats of a received chunk are taken again
+uint8_t epd_xfer_chunk(epd_xfer_t *x, uint16_t seq, uint16_t crc, const uint8_t *data, int len)
+{
+    uint16_t offset = seq * x->chunk;
+
+    if (seq >= x->chunks)
+        return 0;
+    if (len != (x->size - offset < x->chunk ? x->size - offset : x->chunk))
+        return 0;
+    if (epd_crc16(data, len) != crc)
+        return 0;
+
+    memcpy(&x->dst[offset], data, len);
+    if (!(x->bitmap[seq / 8] & (0x80 >> (seq & 7))))
+    {
+        x->bitmap[seq / 8] |= 0x80 >> (seq & 7);
+        x->received++;
+    }
+    return 1;
+}
+
+uint8_t epd_xfer_done(const epd_xfer_t *x)
+{
+    return x->chunks && x->received == x->chunks;
+}
+
+// A complete session with an id is checked against its CRC, on a mismatch
+// every chunk is marked missing again. Returns 0 then
+uint8_t epd_xfer_verify(epd_xfer_t *x)
+{
+    if (!x->id || epd_crc16(x->dst, x->size) == x->crc)
+        return 1;
+    memset(x->bitmap, 0, sizeof(x->bitmap));
+    x->received = 0;
+    return 0;
+}
+
+void epd_xfer_touch(epd_xfer_t *x, uint32_t now)
+{
+    x->touched = now;
+}
+
+// Closes an open session not touched for more than timeout, returns 1 then
+uint8_t epd_xfer_expire(epd_xfer_t *x, uint32_t now, uint32_t timeout)
+{
+    if (!epd_xfer_open(x) || now - x->touched <= timeout)
+        return 0;
+    epd_xfer_close(x);
+    return 1;
+}
+
+// missing_hi, missing_lo, first_hi, first_lo and then the bitmap from chunk
+// first on, rounded down to a multiple of 8. Returns the length written,
+// only the header for a first past the last chunk
+int epd_xfer_status(const epd_xfer_t *x, uint16_t first, uint8_t *out, int max_len)
+{
+    uint16_t missing = x->chunks - x->received;
+    int n;
+
+    first &= ~7;
+    out[0] = missing >> 8;
+    out[1] = missing;
+    out[2] = first >> 8;
+    out[3] = first;
+    if (first / 8 >= (x->chunks + 7) / 8)
+        return 4;
+    n = (x->chunks + 7) / 8 - first / 8;
+    if (n > max_len - 4)
+        n = max_len - 4;
+    memcpy(&out[4], &x->bitmap[first / 8], n);
+    return 4 + n;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+// Chunked upload where every chunk carries its index and a CRC, the
+// receiver keeps one bit per chunk so the sender can retransmit only gaps
+#define EPD_XFER_MAX_CHUNKS 512
+
+typedef struct
+{
+    uint32_t id;  // picked by the host to find its session again, 0 = none
+    uint16_t crc; // CRC-16 of the whole image, checked once complete if id is set
+    uint8_t *dst;
+    uint16_t size;
+    uint8_t chunk; // bytes per chunk, only the last one may be shorter
+    uint16_t chunks;
+    uint16_t received;
+    uint32_t touched; // caller's time of the last start or chunk, see epd_xfer_expire
+    uint8_t bitmap[EPD_XFER_MAX_CHUNKS / 8];
+} epd_xfer_t;
+
+uint16_t epd_crc16(const uint8_t *data, int len);
+uint8_t epd_xfer_start(epd_xfer_t *x, uint8_t *dst, uint16_t size, uint8_t chunk, uint32_t id, uint16_t crc);
+uint8_t epd_xfer_resume(const epd_xfer_t *x, uint32_t id, uint16_t size, uint8_t chunk, uint16_t crc);
+void epd_xfer_close(epd_xfer_t *x);
+uint8_t epd_xfer_open(const epd_xfer_t *x);
+uint8_t epd_xfer_chunk(epd_xfer_t *x, uint16_t seq, uint16_t crc, const uint8_t *data, int len);
+uint8_t epd_xfer_done(const epd_xfer_t *x);
+uint8_t epd_xfer_verify(epd_xfer_t *x);
+void epd_xfer_touch(epd_xfer_t *x, uint32_t now);
+uint8_t epd_xfer_expire(epd_xfer_t *x, uint32_t now, uint32_t timeout);
+int epd_xfer_status(const epd_xfer_t *x, uint16_t first, uint8_t *out, int max_len);
@@ -37,6 +37,13 @@ void reset_settings_to_default(void)
 	settings.measure_interval = 10;
 	settings.temp_offset = 0;
 	settings.temp_alarm_point = 5;
+	settings.epd_model = 0;
+	settings.epd_panel_w = 0;
+	settings.epd_panel_h = 0;
+	settings.epd_fingerprint = 0;
+	settings.broadcast_period = 0;
+	memset(settings.broadcast_key, 0, sizeof(settings.broadcast_key));
+	memset(settings.groups, 0, sizeof(settings.groups));
 }
 
 void save_settings_to_flash(void)
@@ -1,5 +1,7 @@
 #pragma once
 
+#define SETTINGS_GROUPS 4
+
 typedef struct Settings_struct
 {
 	uint32_t magic;
@@ -13,6 +15,13 @@ typedef struct Settings_struct
 	uint8_t measure_interval;//time = loop interval * factor (def: about 7 * X)
 	int8_t temp_offset;
 	uint8_t temp_alarm_point;//divide by ten for value
+	uint8_t epd_model;//detected or selected panel, 0 = probe on next boot
+	uint16_t epd_panel_w;//geometry and init sequence fingerprint of that panel driver,
+	uint16_t epd_panel_h;//the model is probed again if they do not match anymore
+	uint16_t epd_fingerprint;
+	uint16_t broadcast_period;//seconds between scans for signed broadcasts, 0 = off
+	uint8_t broadcast_key[16];//AES-128 key the broadcasts are signed with
+	uint16_t groups[SETTINGS_GROUPS];//groups batches and broadcasts can address, 0 = unused
 	uint8_t crc;// Needs to be at the last position otherwise the settings can not be validated on next boot!!!!
 } settings_struct;
 
@@ -196,4 +196,4 @@ const GFXglyph Dialog_plain_16Glyphs[] PROGMEM = {
 	  {  1082,   6,  15,  11,    2,  -12 } // '}'
 };
 const GFXfont Dialog_plain_16 PROGMEM = {
-(uint8_t  *)Dialog_plain_16Bitmaps,(GFXglyph *)Dialog_plain_16Glyphs,0x20, 0x7E, 19};
\ No newline at end of file
+(uint8_t  *)Dialog_plain_16Bitmaps,(GFXglyph *)Dialog_plain_16Glyphs,0x20, 0x7D, 19};
\ No newline at end of file
@@ -0,0 +1,267 @@
+// Generated by fontc.py from font30.h, do not edit
+const uint8_t Special_Elite_Regular_30_rleBitmaps[] = {
+	0x00,0x10,0x17,0xDE,0x00,0x12,0x33,0x14,0x23,0x22,0x41,0x91,0x23,0x24,0x22,0x20,
+	0x12,0x12,0x23,0x13,0x23,0x22,0x23,0x22,0x31,0x32,0x32,0x31,0x31,0x20,0x18,0x20,
+	0x98,0x63,0x32,0x83,0x23,0x82,0x32,0x82,0x41,0x92,0x32,0x65,0x14,0x11,0x3E,0x52,
+	0x32,0x92,0x31,0x6E,0x2B,0x11,0x61,0x41,0x92,0x32,0x83,0x32,0x82,0x32,0x80,0x27,
+	0x00,0x00,0x0F,0xC0,0x61,0xE2,0xC3,0xD2,0xA8,0x54,0x12,0x14,0x32,0x32,0x32,0x31,
+	0x42,0x23,0x22,0x42,0x23,0x22,0x41,0x32,0x32,0x41,0x93,0x21,0xA6,0xC7,0x91,0x33,
+	0x81,0x52,0x13,0x31,0x52,0x14,0x22,0x42,0x12,0x42,0x42,0x12,0x42,0x32,0x33,0x22,
+	0x23,0x4A,0x75,0xC2,0x70,0x00,0x00,0x00,0x02,0xF0,0x3F,0x04,0xE5,0xD5,0xD5,0xC7,
+	0x69,0x12,0x67,0x33,0x62,0x32,0x32,0x63,0x32,0x22,0x72,0x42,0x22,0x72,0x33,0x12,
+	0x82,0x32,0x21,0x96,0x22,0xA4,0x31,0xF2,0x2F,0x13,0x23,0xB2,0x25,0x92,0x22,0x31,
+	0x92,0x12,0x42,0x72,0x22,0x42,0x72,0x22,0x33,0x62,0x32,0x32,0x72,0x36,0x72,0x54,
+	0x82,0xF1,0x2F,0x13,0xF1,0x2F,0x13,0xF2,0x1F,0x20,0x08,0x00,0x00,0x64,0xE6,0xC3,
+	0x23,0xA3,0x42,0xB2,0x33,0xB3,0x22,0xD2,0x12,0xE4,0x53,0x64,0x46,0x34,0x12,0x36,
+	0x23,0x32,0x32,0x12,0x23,0x52,0x21,0x62,0x62,0x12,0x61,0x84,0x62,0x73,0x51,0x13,
+	0x72,0x42,0x22,0x64,0x32,0x29,0x17,0x3F,0x05,0x64,0x33,0x1E,0x12,0x13,0x22,0x31,
+	0x10,0x2A,0xFF,0xD8,0x00,0x32,0x33,0x23,0x32,0x32,0x52,0x51,0x52,0x51,0x52,0x10,
+	0x54,0x8E,0xC4,0x00,0x03,0x53,0x53,0x52,0x53,0x52,0x43,0x52,0x42,0x51,0x62,0x42,
+	0x42,0x43,0x51,0x50,0x02,0x10,0x32,0x42,0x73,0x32,0x73,0x23,0x82,0x22,0xA4,0x6E,
+	0x64,0xA2,0x12,0x93,0x22,0x82,0x33,0xD1,0x50,0x38,0xE0,0x61,0xD2,0x6C,0x2D,0x72,
+	0xB3,0xC2,0x60,0x24,0x00,0x41,0x55,0x46,0x37,0x26,0x41,0x13,0x63,0x53,0x53,0x54,
+	0x44,0x62,0x60,0x00,0x02,0x21,0x11,0x11,0x21,0x11,0x21,0x1D,0x1F,0x0D,0x22,0x14,
+	0x15,0x25,0x37,0x16,0x34,0x30,0x10,0x04,0x12,0xD2,0xD3,0xC3,0xC3,0xD2,0xD3,0xD2,
+	0xD3,0xD2,0xD3,0xD2,0xD2,0xD2,0xD3,0xD2,0xD2,0xD3,0xC3,0xC3,0xD2,0xE0,0x00,0x01,
+	0x00,0x71,0xB8,0x74,0x33,0x53,0x63,0x42,0x82,0x42,0x92,0x22,0xA2,0x22,0xB1,0x21,
+	0xC1,0x22,0xB2,0x11,0xC1,0x21,0xC2,0x11,0xB2,0x22,0xA3,0x12,0xA2,0x22,0x93,0x32,
+	0x83,0x33,0x62,0x6A,0x78,0xA5,0x60,0x0E,0x7F,0xC8,0x18,0x89,0x91,0x21,0x22,0xF0,
+	0x2F,0x03,0xE2,0x91,0x44,0x23,0x2F,0x11,0x02,0x00,0x00,0x38,0x54,0x42,0x51,0x82,
+	0x32,0x92,0x23,0x82,0x24,0x63,0xB3,0xB3,0xA4,0x95,0x85,0xA3,0xB3,0xB3,0xC2,0xD7,
+	0x52,0x14,0x14,0x32,0x13,0x38,0x12,0x64,0x41,0xD0,0x00,0x04,0x00,0x76,0x4B,0x33,
+	0x62,0x42,0x63,0x51,0x52,0x62,0x42,0xC3,0xB4,0xA6,0x82,0x16,0x62,0x53,0xD2,0xE2,
+	0x22,0x92,0x14,0x82,0x14,0x73,0x13,0x83,0x22,0x64,0x3B,0x5A,0x84,0x60,0x00,0x48,
+	0x80,0xA3,0xE4,0xD5,0xD2,0x12,0xC2,0x22,0xB3,0x22,0xA3,0x32,0x93,0x42,0x83,0x52,
+	0x73,0x62,0x63,0x72,0x5F,0x22,0xF1,0xC2,0xF0,0x3D,0x98,0xA8,0x12,0x31,0x22,0x00,
+	0x04,0x00,0x22,0x61,0x5B,0x42,0x34,0x62,0xE1,0xD3,0xD2,0xC3,0x15,0x6A,0x54,0x43,
+	0x52,0x63,0xD3,0xD2,0x23,0x82,0x14,0x82,0x23,0x72,0x33,0x63,0x43,0x43,0x59,0x86,
+	0x50,0x01,0x02,0x00,0x75,0x89,0x73,0x43,0x52,0x64,0x32,0x64,0x33,0x73,0x32,0xE2,
+	0x25,0x72,0x19,0x44,0x54,0x24,0x74,0x13,0x93,0x22,0xA2,0x22,0x93,0x32,0x83,0x33,
+	0x64,0x34,0x35,0x69,0x85,0x60,0x00,0x01,0x40,0x64,0x9A,0x13,0x3E,0x23,0x39,0x23,
+	0x93,0x22,0xA2,0x23,0x93,0x31,0xA2,0xE2,0xE3,0xE2,0xE3,0xE2,0xE3,0xE2,0xE3,0xD4,
+	0xE2,0xE3,0xE2,0xF1,0x19,0x02,0x00,0x00,0x62,0xB8,0x74,0x24,0x53,0x63,0x33,0x83,
+	0x23,0x92,0x32,0x82,0x43,0x72,0x5B,0x5A,0x54,0x43,0x43,0x83,0x22,0x93,0x22,0xA2,
+	0x22,0xA3,0x12,0xA2,0x23,0x83,0x24,0x64,0x2D,0x4B,0x85,0x70,0x04,0x00,0x00,0x47,
+	0x83,0x24,0x62,0x63,0x42,0x81,0x52,0x92,0x22,0xA3,0x22,0x93,0x22,0x84,0x24,0x64,
+	0x4C,0x57,0x13,0x81,0x43,0xD2,0x42,0x82,0x34,0x62,0x42,0x11,0x62,0x45,0x24,0x69,
+	0x87,0xA4,0x80,0x00,0x8A,0x21,0x64,0x36,0x23,0x11,0x36,0x34,0x61,0xD5,0x25,0x37,
+	0x16,0x34,0x30,0x00,0x34,0x00,0x31,0x74,0x46,0x35,0x46,0x44,0x61,0xF3,0x15,0x63,
+	0x72,0x64,0x11,0x36,0x35,0x35,0x35,0x44,0x46,0x26,0x00,0x00,0x83,0x84,0x74,0x64,
+	0x65,0x64,0x74,0x83,0xA3,0xA5,0x94,0xA5,0x93,0x10,0x4C,0x80,0x0F,0x02,0xEF,0x28,
+	0x11,0x14,0x1F,0x01,0x00,0x00,0x03,0x94,0x94,0xA4,0x94,0xA4,0x94,0x93,0x83,0x65,
+	0x55,0x55,0x73,0x90,0x01,0x06,0x40,0x43,0x87,0x53,0x34,0x23,0x71,0x23,0x72,0x14,
+	0x62,0x24,0x52,0x24,0x42,0x94,0x74,0x84,0x93,0xB2,0xF8,0x2A,0x4A,0x49,0x36,0x00,
+	0x10,0x00,0x58,0xA4,0x33,0x83,0x72,0x63,0x92,0x52,0x42,0x42,0x42,0x38,0x12,0x32,
+	0x32,0x33,0x12,0x32,0x23,0x32,0x22,0x23,0x22,0x42,0x22,0x23,0x13,0x41,0x32,0x23,
+	0x13,0x32,0x32,0x32,0x13,0x23,0x22,0x42,0x2A,0x52,0x33,0x23,0x22,0x32,0xC1,0x43,
+	0xA2,0x53,0x73,0x85,0x14,0xB6,0x60,0x34,0x12,0x00,0x73,0xE5,0xC6,0xC3,0x12,0xC2,
+	0x23,0xA3,0x23,0xB2,0x32,0xA3,0x32,0xA3,0x33,0x99,0x84,0x11,0x22,0x83,0x52,0x83,
+	0x61,0x82,0x63,0x56,0x37,0x17,0x36,0x20,0x06,0x23,0x00,0x0C,0x5D,0x65,0x34,0x62,
+	0x73,0x52,0x82,0x52,0x73,0x53,0x44,0x6B,0x63,0x53,0x62,0x73,0x52,0x83,0x42,0x81,
+	0x62,0x73,0x43,0x63,0x4C,0x5A,0x60,0x04,0x02,0x00,0x55,0x22,0x5C,0x3D,0x33,0x46,
+	0x23,0x74,0x22,0x93,0x22,0xA2,0x22,0x92,0x32,0xD3,0xD3,0x92,0x23,0x93,0x22,0x93,
+	0x22,0x83,0x42,0x73,0x42,0x54,0x6A,0x78,0x95,0x60,0x01,0xBA,0x00,0x1A,0x6C,0x5E,
+	0x54,0x53,0x63,0x63,0x53,0x72,0x53,0x73,0x43,0x82,0x43,0x73,0x42,0x83,0x42,0x73,
+	0x53,0x54,0x54,0x25,0x4C,0x5B,0x50,0x04,0x02,0x00,0x43,0x17,0x3F,0x13,0xC1,0x24,
+	0x2A,0x25,0x1A,0x25,0x15,0x23,0x34,0x15,0x15,0x15,0x15,0x2A,0x8A,0x11,0x5B,0x8A,
+	0x24,0x2A,0x24,0x23,0x25,0x29,0x34,0x29,0x25,0x1A,0x24,0x38,0x33,0xF0,0x3E,0x30,
+	0x02,0x36,0x48,0x1E,0x3F,0x14,0x43,0x75,0x29,0x25,0x29,0x34,0x24,0x23,0x34,0x24,
+	0x2A,0x23,0x3A,0x8A,0x24,0x2A,0x24,0x1B,0x2E,0x6B,0x8A,0x00,0x03,0x00,0x55,0x31,
+	0x7B,0x64,0x35,0x63,0x63,0x53,0x73,0x52,0x93,0x42,0x92,0x52,0xA1,0x52,0xF0,0x3F,
+	0x03,0x76,0x32,0x77,0x22,0x84,0x42,0x93,0x52,0x74,0x53,0x64,0x63,0x36,0x7B,0x94,
+	0x32,0x30,0x0F,0x87,0xC0,0x13,0x11,0x41,0x32,0x37,0x37,0x35,0x55,0x62,0x82,0x77,
+	0x23,0x7C,0x77,0x23,0x72,0x82,0x73,0x72,0x48,0x27,0x28,0x28,0xD1,0x60,0x0F,0xE7,
+	0xE8,0x1C,0x1D,0x15,0x16,0x73,0xC2,0xB3,0x6D,0x21,0x82,0x20,0x0D,0x51,0x80,0x4A,
+	0x6B,0x6A,0x93,0xE2,0xD3,0xE2,0xD3,0x53,0x62,0x54,0x52,0x53,0x52,0x63,0x42,0x88,
+	0xA5,0x80,0x01,0x01,0x00,0x07,0x35,0x38,0x17,0x44,0x43,0x82,0x52,0x92,0x42,0xA2,
+	0x33,0xA2,0x23,0xB2,0x13,0xC6,0xC7,0xB3,0x23,0xA2,0x33,0xA2,0x42,0xA2,0x52,0x92,
+	0x61,0x92,0x62,0x73,0x62,0x66,0x35,0x46,0x37,0x10,0x01,0x9D,0xE8,0x61,0xAA,0x79,
+	0x81,0x24,0xD3,0xE2,0xF0,0x3E,0x2F,0x03,0xE3,0x82,0x2F,0x01,0xF0,0x20,0x00,0x00,
+	0x80,0x23,0xA1,0x55,0x66,0x44,0x66,0x45,0x54,0x65,0x45,0x65,0x54,0x74,0x46,0x65,
+	0x32,0x13,0x61,0x22,0x32,0x13,0x62,0x12,0x32,0x21,0x72,0x12,0x31,0x22,0x63,0x12,
+	0x31,0x22,0x63,0x21,0x31,0x31,0x63,0x21,0x31,0x22,0x72,0x22,0x12,0x31,0x72,0x25,
+	0x31,0x71,0x32,0x11,0x41,0x54,0x33,0x41,0x46,0x23,0x26,0x25,0x31,0x35,0x20,0x00,
+	0x44,0x20,0x14,0x55,0x36,0x38,0x26,0x36,0x45,0x53,0x64,0x53,0x65,0x43,0x62,0x12,
+	0x43,0x62,0x12,0x52,0x62,0x22,0x42,0x62,0x31,0x41,0x72,0x32,0x32,0x62,0x42,0x22,
+	0x62,0x42,0x21,0x72,0x43,0x11,0x72,0x52,0x12,0x62,0x64,0x47,0x34,0x38,0x42,0x40,
+	0x00,0x5E,0x00,0x66,0x8A,0x6C,0x53,0x63,0x43,0x83,0x33,0x92,0x32,0xA2,0x23,0xA3,
+	0x13,0xB2,0x22,0xB2,0x23,0x92,0x43,0x82,0x44,0x63,0x45,0x43,0x6B,0x79,0xA5,0x60,
+	0x06,0x07,0xC0,0x31,0x11,0x11,0x8C,0x6B,0x62,0x63,0x52,0x73,0x41,0x83,0x42,0x72,
+	0x53,0x26,0x5A,0x68,0x82,0xE3,0xB6,0x98,0x80,0x05,0x08,0x00,0x47,0x99,0x73,0x53,
+	0x53,0x82,0x42,0x92,0x42,0xA2,0x23,0xA2,0x22,0xB2,0x31,0xC1,0x31,0xB2,0x32,0xA2,
+	0x32,0x33,0x42,0x42,0x16,0x12,0x5C,0x55,0x15,0x79,0x98,0xC4,0x41,0xB2,0x22,0xB3,
+	0x12,0xC3,0x30,0x0E,0x02,0x00,0x2C,0x8D,0x84,0x53,0x92,0x82,0x82,0x73,0x82,0x55,
+	0x8B,0x9A,0xA3,0x43,0xA2,0x62,0xA2,0x63,0x92,0x72,0x92,0x63,0x92,0x72,0x21,0x64,
+	0x56,0x28,0x45,0x28,0x64,0x20,0x02,0x01,0x80,0xB1,0x69,0x5B,0x34,0x53,0x32,0x73,
+	0x23,0x82,0x32,0x91,0x34,0xC9,0x89,0xC3,0x21,0xA3,0x11,0xB2,0x12,0xA2,0x13,0x74,
+	0x14,0x54,0x2B,0x4A,0x50,0x0A,0x7F,0x40,0x0F,0x02,0xB2,0x31,0x25,0x25,0x21,0x25,
+	0x24,0x31,0x25,0x25,0x21,0x16,0x25,0x19,0x2F,0x03,0xB9,0x7A,0x76,0x80,0x43,0xFA,
+	0x80,0x07,0x28,0x34,0x45,0x53,0x72,0x62,0x81,0x72,0x82,0x63,0x72,0x72,0x72,0x72,
+	0x62,0x84,0x24,0x95,0x12,0xB6,0x70,0x20,0x8C,0x4C,0xD3,0x37,0x38,0x35,0x45,0x63,
+	0x63,0x82,0x63,0x82,0x62,0x92,0x53,0xA2,0x43,0x93,0x33,0xB2,0x33,0xC2,0x23,0xC2,
+	0x22,0xD6,0xD5,0xF0,0x48,0x08,0x01,0xA0,0x71,0x21,0x43,0x1F,0x32,0x34,0x33,0x44,
+	0x14,0x34,0x2A,0x43,0x16,0x14,0x34,0x16,0x14,0x11,0x22,0x26,0x23,0x11,0x22,0x27,
+	0x13,0x11,0x22,0x27,0x12,0x21,0x31,0x27,0x21,0x12,0x22,0x27,0x21,0x13,0x21,0x18,
+	0x21,0x22,0x48,0x43,0x49,0x33,0x49,0x34,0x39,0x25,0x25,0x04,0x34,0x00,0x16,0x45,
+	0x27,0x37,0x43,0x53,0x82,0x52,0xA2,0x32,0xC2,0x12,0xD5,0xE4,0xE3,0xE5,0xC3,0x22,
+	0xB2,0x33,0x92,0x52,0x83,0x53,0x65,0x37,0x18,0x27,0x17,0x37,0x10,0x00,0x07,0xC4,
+	0x33,0x61,0x31,0x38,0x18,0x19,0x18,0x45,0x45,0x72,0x53,0x93,0x33,0xB2,0x32,0xC3,
+	0x13,0xD6,0xD5,0xF0,0x4F,0x03,0xF2,0x2F,0x13,0xDA,0x7D,0x30,0x12,0x00,0x18,0x01,
+	0x1B,0x3D,0x32,0x65,0x32,0x64,0x42,0x54,0xB4,0xB4,0xC3,0xC4,0xC3,0xB4,0x61,0x63,
+	0x62,0x34,0x73,0x14,0x82,0x24,0x83,0x14,0x11,0x44,0x2E,0x20,0x0F,0x91,0x3C,0x00,
+	0x11,0x21,0x26,0x13,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x54,0x35,0x20,
+	0x00,0x45,0x44,0x02,0xE3,0xE2,0xE3,0xE2,0xE3,0xE2,0xE3,0xE3,0xE3,0xE2,0xF0,0x2F,
+	0x02,0xF0,0x2F,0x02,0xE3,0xE3,0xE3,0xE2,0x10,0x17,0xFF,0xFC,0x00,0x21,0x21,0x35,
+	0x62,0x63,0x52,0x35,0x26,0x20,0x00,0x40,0x43,0xA4,0x85,0x82,0x13,0x62,0x32,0x62,
+	0x42,0x42,0x53,0x32,0x63,0x12,0x82,0x10,0x00,0x81,0x21,0x4F,0x01,0xE2,0x00,0x01,
+	0x72,0x64,0x63,0x73,0x61,0x20,0x00,0x00,0x46,0x99,0x84,0x33,0x64,0x52,0x64,0x62,
+	0x63,0x62,0xC5,0x7A,0x57,0x32,0x53,0x72,0x43,0x82,0x42,0x83,0x43,0x73,0x12,0x2F,
+	0x03,0x73,0x32,0x0C,0x04,0x00,0x12,0xF0,0x5E,0x4F,0x12,0xF1,0x24,0x1C,0x99,0xB6,
+	0x46,0x26,0x38,0x26,0x28,0x25,0x39,0x24,0x38,0x26,0x19,0x34,0x38,0x25,0x37,0x36,
+	0x35,0x37,0xB7,0x11,0x84,0x00,0xC0,0x56,0x6B,0x31,0x1A,0x34,0x45,0x23,0x55,0x22,
+	0x74,0x22,0x73,0x23,0xD2,0x82,0x33,0x73,0x33,0x45,0x4A,0x67,0xC1,0x60,0x0C,0x04,
+	0x40,0x83,0x11,0xC7,0xC6,0xF0,0x39,0x24,0x37,0xB6,0xC5,0x44,0x55,0x37,0x35,0x28,
+	0x34,0x39,0x24,0x38,0x34,0x29,0x35,0x37,0x36,0x34,0x56,0xF0,0x57,0x15,0x73,0x90,
+	0x00,0x00,0x54,0x98,0x64,0x24,0x43,0x72,0x32,0x91,0x23,0x92,0x23,0x31,0x33,0x1E,
+	0x14,0x81,0x23,0xD2,0xD3,0x82,0x33,0x63,0x4A,0x68,0x93,0x60,0x00,0xBF,0x88,0x76,
+	0xA8,0x84,0x15,0x63,0x44,0x63,0x45,0x53,0x53,0x63,0x61,0x49,0xB3,0xE2,0xF0,0x3A,
+	0xB6,0x35,0x27,0x00,0x08,0x00,0xD2,0x66,0x14,0x49,0x14,0x33,0x47,0x32,0x64,0x52,
+	0x72,0x62,0x63,0x63,0x52,0x82,0x43,0x79,0x79,0x82,0xF0,0x61,0x37,0xD4,0x46,0x42,
+	0x3A,0x31,0x2B,0x31,0x3A,0x32,0x45,0x54,0xB9,0x48,0x18,0x19,0x00,0x05,0xF0,0x4F,
+	0x22,0xF2,0x25,0x2A,0x23,0x68,0xB8,0x55,0x27,0x46,0x27,0x37,0x27,0x28,0x28,0x28,
+	0x17,0x38,0x17,0x37,0x34,0x11,0x53,0x72,0x72,0x82,0x55,0x17,0x24,0x2F,0xC0,0x53,
+	0xD5,0xD3,0xFC,0x79,0x9B,0x13,0x2F,0x02,0xF0,0x38,0x12,0x11,0x92,0xA2,0x42,0x49,
+	0x12,0x00,0x3F,0xF2,0x00,0x54,0x66,0x65,0x63,0x11,0x73,0xF0,0x74,0x88,0x39,0x21,
+	0x35,0x21,0x44,0x21,0x42,0x41,0x41,0x43,0x66,0x36,0x1C,0x00,0x00,0x05,0xF0,0x4F,
+	0x22,0xF2,0x25,0x76,0x15,0x76,0x15,0x3A,0x14,0x3B,0x13,0x3C,0x21,0x3D,0x6D,0x7B,
+	0x42,0x3B,0x24,0x39,0x35,0x28,0x45,0x35,0x82,0x73,0x72,0x8C,0x31,0x22,0x13,0xFF,
+	0x90,0x08,0x99,0xF0,0x2E,0x3F,0x02,0xE3,0x8F,0x12,0x41,0x11,0x13,0x32,0x01,0x50,
+	0x71,0x42,0x63,0x1A,0x4F,0x15,0x42,0x41,0x35,0x33,0x32,0x35,0x24,0x32,0x35,0x33,
+	0x23,0x35,0x24,0x24,0x25,0x33,0x24,0x25,0x33,0x23,0x34,0x42,0x51,0x52,0x51,0x41,
+	0x62,0x3A,0x21,0x11,0x00,0xE8,0x21,0x63,0x65,0x27,0x45,0x18,0x66,0x43,0x64,0x53,
+	0x63,0x72,0x62,0x82,0x62,0x73,0x62,0x82,0x46,0x37,0x18,0x27,0x35,0x51,0x11,0x30,
+	0x00,0x20,0x73,0xA8,0x6B,0x53,0x54,0x33,0x83,0x22,0x93,0x13,0x93,0x22,0x93,0x13,
+	0xB1,0x13,0x93,0x23,0x74,0x33,0x54,0x5A,0x78,0xA5,0x50,0x00,0x20,0xC0,0x14,0x34,
+	0x5E,0x64,0x53,0x62,0x72,0x62,0x82,0x43,0x82,0x51,0xA1,0x42,0xA1,0x43,0x82,0x52,
+	0x82,0x52,0x72,0x64,0x42,0x7A,0x71,0x34,0x91,0xF0,0x2C,0x8A,0x31,0x2A,0x02,0xA0,
+	0xE0,0x61,0xD7,0x13,0x5C,0x44,0x44,0x52,0x82,0x43,0x83,0x33,0x82,0x52,0x82,0x53,
+	0x63,0x63,0x44,0x7A,0x86,0x22,0xF0,0x2D,0x5B,0x71,0x00,0xF0,0xB2,0x46,0x27,0x2F,
+	0x06,0x62,0x45,0x44,0x45,0x35,0x36,0x3E,0x2F,0x03,0xC8,0x78,0x11,0x70,0x00,0x10,
+	0x36,0x7A,0x33,0x26,0x33,0x62,0x32,0x72,0x33,0x71,0x39,0x62,0x17,0xC3,0x12,0x92,
+	0x22,0x82,0x23,0x54,0x2B,0x3A,0x41,0xC0,0x10,0x3E,0x20,0x51,0xE2,0xE3,0xD2,0xE3,
+	0xAB,0x4D,0x47,0xC3,0xD3,0x53,0x53,0x44,0x54,0x33,0x79,0x78,0xA4,0x50,0x0E,0x00,
+	0x22,0xA1,0x56,0x45,0x65,0x46,0x82,0x73,0x82,0x72,0x92,0x73,0x82,0x72,0x92,0x73,
+	0x82,0x63,0x92,0x48,0x6F,0x06,0x71,0x67,0x36,0x32,0x49,0x04,0x08,0x28,0x43,0x63,
+	0x82,0x62,0x93,0x42,0xB2,0x42,0xB3,0x23,0xC2,0x22,0xD2,0x13,0xD6,0xE4,0xF1,0x29,
+	0x00,0x0C,0xF1,0x32,0x71,0xC1,0x71,0x51,0x62,0x11,0x23,0x43,0x36,0x23,0x43,0x28,
+	0x22,0x43,0x28,0x22,0x12,0x13,0x28,0x22,0x21,0x22,0x28,0x22,0x21,0x21,0x38,0x21,
+	0x31,0x59,0x53,0x4A,0x43,0x4B,0x25,0x26,0x01,0x80,0x09,0x28,0x28,0x28,0x63,0x43,
+	0xA3,0x33,0xC3,0x13,0xE5,0xF1,0x4F,0x06,0xD3,0x23,0xB3,0x43,0x77,0x27,0x38,0x28,
+	0x36,0x47,0x10,0x00,0x0A,0x00,0xF0,0x13,0x82,0x81,0x82,0x76,0x35,0x38,0x26,0x2A,
+	0x25,0x2A,0x24,0x3B,0x23,0x2C,0x22,0x3C,0x22,0x2E,0x5E,0x4F,0x12,0xB1,0x52,0xA4,
+	0x23,0x96,0x12,0xB8,0xB7,0xD5,0xF0,0x3D,0x00,0x00,0x1C,0x3B,0x42,0x63,0x42,0x62,
+	0x52,0x52,0x62,0x42,0xC2,0xC2,0xC2,0x52,0x52,0x62,0x43,0x62,0x34,0x63,0x2D,0x1E,
+	0x31,0x55,0x20,0x20,0x21,0x54,0x41,0x53,0x33,0x42,0x43,0x42,0x62,0x61,0x53,0x24,
+	0x33,0x54,0x43,0x42,0x43,0x53,0x53,0x51,0x20,0x7F,0xFF,0xFE,0x02,0x10,0x00,0x49,
+	0x4A,0x11,0x53,0x53,0x52,0x53,0x52,0x43,0x42,0x43,0x53,0x53,0x34,0x23,0x52,0x62,
+	0x43,0x33,0x42,0x40,
+};
+const GFXglyph Special_Elite_Regular_30_rleGlyphs[] = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   1,   1,  10,    0,    0 }, // ' '
+	  {     2,   5,  21,   9,    2,  -21 }, // '!'
+	  {    16,   9,   8,  12,    1,  -21 }, // '"'
+	  {    30,  16,  21,  18,    1,  -21 }, // '#'
+	  {    63,  15,  34,  17,    1,  -28 }, // '$'
+	  {   117,  19,  32,  21,    1,  -26 }, // '%'
+	  {   186,  19,  21,  21,    1,  -21 }, // '&'
+	  {   235,   4,   8,   7,    1,  -21 }, // "'"
+	  {   241,   6,  25,   9,    2,  -23 }, // '('
+	  {   256,   7,  25,   9,    1,  -23 }, // ')'
+	  {   276,  15,  13,  17,    1,  -21 }, // '*'
+	  {   297,  14,  13,  16,    1,  -17 }, // '+'
+	  {   307,   9,  14,  11,    1,   -8 }, // ','
+	  {   323,  16,   4,  20,    2,  -12 }, // '-'
+	  {   335,   8,   7,  11,    2,   -7 }, // '.'
+	  {   342,  16,  24,  18,    1,  -23 }, // '/'
+	  {   366,  16,  22,  19,    2,  -22 }, // '0'
+	  {   407,  17,  21,  18,    1,  -21 }, // '1'
+	  {   424,  15,  21,  18,    2,  -20 }, // '2'
+	  {   458,  15,  22,  18,    1,  -21 }, // '3'
+	  {   494,  18,  21,  19,    0,  -21 }, // '4'
+	  {   527,  15,  21,  17,    1,  -21 }, // '5'
+	  {   561,  16,  21,  19,    1,  -21 }, // '6'
+	  {   598,  17,  23,  18,    0,  -22 }, // '7'
+	  {   629,  16,  22,  19,    2,  -22 }, // '8'
+	  {   668,  16,  21,  19,    1,  -21 }, // '9'
+	  {   707,   8,  16,  11,    2,  -16 }, // ':'
+	  {   723,   9,  22,  11,    1,  -16 }, // ';'
+	  {   746,  12,  13,  15,    1,  -17 }, // '<'
+	  {   762,  16,   9,  20,    2,  -15 }, // '='
+	  {   772,  12,  13,  15,    2,  -17 }, // '>'
+	  {   788,  13,  22,  15,    1,  -22 }, // '?'
+	  {   815,  19,  20,  21,    1,  -20 }, // '@'
+	  {   871,  18,  21,  18,    0,  -21 }, // 'A'
+	  {   904,  17,  21,  19,    1,  -21 }, // 'B'
+	  {   935,  16,  21,  18,    1,  -21 }, // 'C'
+	  {   970,  17,  21,  20,    1,  -21 }, // 'D'
+	  {   999,  18,  21,  20,    1,  -21 }, // 'E'
+	  {  1040,  18,  21,  19,    1,  -21 }, // 'F'
+	  {  1067,  18,  21,  19,    1,  -21 }, // 'G'
+	  {  1106,  19,  22,  21,    1,  -21 }, // 'H'
+	  {  1134,  14,  22,  16,    1,  -21 }, // 'I'
+	  {  1148,  16,  21,  17,    1,  -21 }, // 'J'
+	  {  1170,  18,  21,  18,    1,  -21 }, // 'K'
+	  {  1210,  17,  22,  19,    1,  -22 }, // 'L'
+	  {  1230,  20,  21,  22,    1,  -21 }, // 'M'
+	  {  1295,  18,  21,  20,    1,  -21 }, // 'N'
+	  {  1344,  17,  22,  20,    1,  -21 }, // 'O'
+	  {  1376,  16,  21,  18,    1,  -21 }, // 'P'
+	  {  1401,  17,  24,  19,    1,  -21 }, // 'Q'
+	  {  1443,  20,  21,  20,    0,  -21 }, // 'R'
+	  {  1478,  15,  21,  19,    2,  -21 }, // 'S'
+	  {  1509,  17,  21,  19,    1,  -21 }, // 'T'
+	  {  1534,  18,  21,  20,    1,  -21 }, // 'U'
+	  {  1559,  19,  22,  19,    0,  -22 }, // 'V'
+	  {  1589,  19,  21,  20,    0,  -21 }, // 'W'
+	  {  1643,  18,  21,  18,    0,  -21 }, // 'X'
+	  {  1677,  19,  22,  18,   -1,  -22 }, // 'Y'
+	  {  1708,  16,  21,  19,    2,  -21 }, // 'Z'
+	  {  1740,   7,  25,  10,    3,  -23 }, // '['
+	  {  1760,  16,  24,  18,    1,  -23 }, // '\\'
+	  {  1785,   8,  25,  10,    0,  -23 }, // ']'
+	  {  1798,  13,  10,  13,    0,  -21 }, // '^'
+	  {  1816,  16,   3,  21,    4,    3 }, // '_'
+	  {  1822,   8,   6,   8,    0,  -23 }, // '`'
+	  {  1830,  17,  15,  18,    1,  -15 }, // 'a'
+	  {  1859,  18,  21,  18,   -1,  -21 }, // 'b'
+	  {  1893,  15,  16,  17,    1,  -15 }, // 'c'
+	  {  1918,  18,  22,  19,    1,  -21 }, // 'd'
+	  {  1952,  15,  16,  17,    1,  -15 }, // 'e'
+	  {  1980,  17,  22,  15,    1,  -21 }, // 'f'
+	  {  2003,  17,  22,  18,    1,  -15 }, // 'g'
+	  {  2042,  19,  21,  20,    0,  -20 }, // 'h'
+	  {  2076,  17,  21,  18,    1,  -20 }, // 'i'
+	  {  2097,  11,  27,  13,    0,  -20 }, // 'j'
+	  {  2122,  19,  21,  20,    0,  -20 }, // 'k'
+	  {  2158,  17,  21,  17,    0,  -20 }, // 'l'
+	  {  2174,  19,  16,  21,    1,  -15 }, // 'm'
+	  {  2212,  18,  16,  20,    1,  -15 }, // 'n'
+	  {  2240,  16,  16,  19,    1,  -15 }, // 'o'
+	  {  2267,  17,  21,  19,    0,  -14 }, // 'p'
+	  {  2302,  17,  21,  18,    1,  -15 }, // 'q'
+	  {  2330,  17,  15,  18,    1,  -15 }, // 'r'
+	  {  2350,  14,  16,  17,    1,  -15 }, // 's'
+	  {  2376,  16,  22,  16,    0,  -21 }, // 't'
+	  {  2398,  20,  16,  20,    0,  -15 }, // 'u'
+	  {  2426,  19,  15,  19,    0,  -14 }, // 'v'
+	  {  2448,  21,  15,  21,    0,  -15 }, // 'w'
+	  {  2488,  20,  15,  21,    0,  -14 }, // 'x'
+	  {  2515,  19,  22,  19,    0,  -15 }, // 'y'
+	  {  2552,  15,  15,  17,    1,  -14 }, // 'z'
+	  {  2579,   7,  24,   9,    1,  -22 }, // '{'
+	  {  2601,   3,  23,   9,    3,  -22 }, // '|'
+	  {  2606,   7,  24,   9,    1,  -22 }, // '}'
+};
+const GFXfont Special_Elite_Regular_30_rle = {
+(uint8_t  *)Special_Elite_Regular_30_rleBitmaps,(GFXglyph *)Special_Elite_Regular_30_rleGlyphs,0x20, 0x7D, 31, OBD_FONT_RLE};
@@ -0,0 +1,305 @@
+// Generated by fontc.py from font_60.h, do not edit
+const uint8_t DSEG14_Classic_Mini_Regular_40_rleBitmaps[] = {
+	0x00,0x10,0x00,0x10,0x0F,0xF0,0x02,0xD3,0xC4,0xB4,0x64,0x14,0x73,0x14,0x72,0x23,
+	0x91,0x22,0xD0,0x3F,0xFF,0xFF,0x80,0x0A,0x11,0x81,0x1A,0x10,0x01,0xFE,0x08,0x3F,
+	0xD0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x63,0xF8,0x4F,0x74,0x64,0xC4,0x73,0xC4,
+	0x72,0xD3,0x91,0xD2,0x35,0x46,0xA7,0x37,0xA5,0x46,0x32,0xD1,0x93,0xC2,0x84,0xC3,
+	0x74,0xB4,0x74,0xF7,0x46,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x00,0xC0,0x40,0x60,
+	0x80,0x02,0xF9,0x3F,0x84,0xF7,0x42,0x1B,0x17,0x42,0x1A,0x27,0x42,0x29,0x27,0x42,
+	0x28,0x37,0x42,0x37,0x37,0x42,0x37,0x28,0x43,0x27,0x28,0x44,0x17,0x19,0x4F,0x73,
+	0xF8,0x23,0x54,0x6A,0x73,0x7A,0x54,0x63,0x2F,0x83,0xF7,0x49,0x17,0x14,0x48,0x27,
+	0x23,0x47,0x37,0x23,0x47,0x37,0x32,0x47,0x28,0x32,0x47,0x29,0x22,0x47,0x1A,0x22,
+	0x47,0x1B,0x12,0x4F,0x74,0xF8,0x22,0x04,0x18,0x78,0x0C,0x10,0x0F,0x35,0xF4,0x5F,
+	0x27,0xF0,0xFF,0x21,0xB1,0xA1,0xA2,0xA2,0x92,0xA2,0x83,0xA3,0x73,0xA3,0x72,0xC2,
+	0x72,0xD1,0x71,0xFF,0xF7,0x2F,0x53,0xF4,0x46,0x17,0x14,0x45,0x27,0x23,0x44,0x37,
+	0x23,0x44,0x37,0x32,0x44,0x28,0x32,0x44,0x29,0x22,0x44,0x1A,0x22,0x44,0x1B,0x12,
+	0x4F,0x44,0x3F,0x02,0x23,0xF2,0x5F,0x44,0xF3,0x50,0x7F,0x80,0x04,0x23,0x22,0x41,
+	0x20,0x2E,0x9F,0xCB,0xA0,0x21,0x22,0x13,0x12,0x21,0x71,0x32,0x23,0x22,0x31,0x10,
+	0x57,0x1F,0xC7,0x50,0x01,0x32,0x23,0x22,0x31,0x71,0x22,0x13,0x12,0x21,0x30,0x06,
+	0x02,0x03,0x00,0x31,0x34,0x41,0x71,0x34,0x32,0x72,0x24,0x32,0x72,0x24,0x23,0x73,
+	0x14,0x23,0x73,0x14,0x22,0x92,0x14,0x22,0xA1,0x23,0x21,0xE2,0xF4,0x1C,0x54,0x64,
+	0x73,0x74,0x54,0x6C,0x1F,0x32,0xF0,0x12,0x32,0x1A,0x21,0x42,0x28,0x31,0x42,0x28,
+	0x31,0x42,0x37,0x22,0x42,0x37,0x22,0x43,0x27,0x13,0x43,0x27,0x13,0x44,0x14,0x7F,
+	0x82,0x0F,0xF0,0x74,0xF2,0x3F,0x22,0xF4,0x1C,0x54,0x64,0x73,0x74,0x54,0x6C,0x1F,
+	0x32,0xF3,0x3F,0x14,0x90,0x1D,0x40,0x21,0x22,0x13,0x12,0x21,0x30,0x20,0x25,0x46,
+	0x47,0x37,0x45,0x46,0x30,0x30,0x12,0x24,0x22,0x20,0x2E,0x9F,0xC7,0x50,0xC1,0xC2,
+	0xB3,0xB2,0xC1,0xF4,0x1C,0x2B,0x3B,0x2C,0x1D,0x00,0xBA,0x08,0x1D,0x40,0x3F,0x38,
+	0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x14,0xE1,0x24,0x14,0xD2,
+	0x24,0x14,0xC3,0x24,0x14,0xC2,0x34,0x14,0xC1,0x44,0x14,0xF2,0x41,0x3F,0x43,0x12,
+	0xF6,0x2F,0xC2,0xF6,0x21,0x3F,0x43,0x14,0xF2,0x41,0x44,0x1C,0x41,0x43,0x2C,0x41,
+	0x42,0x3C,0x41,0x42,0x2D,0x41,0x42,0x1E,0x41,0x4F,0x24,0x13,0xF3,0x41,0x23,0xF0,
+	0x22,0x6F,0x28,0xF4,0x7F,0x35,0x3F,0xFC,0x47,0xFF,0x80,0x12,0x24,0x23,0x32,0x82,
+	0x23,0x14,0x22,0x20,0x07,0xFF,0x88,0xFF,0xE0,0x3F,0x38,0xF4,0x8F,0x2A,0xF0,0x22,
+	0xF8,0x4F,0x83,0x65,0x46,0x32,0x57,0x37,0x52,0x35,0x46,0x63,0xF8,0x4F,0x73,0xF8,
+	0x23,0xF0,0xAF,0x28,0xF4,0x7F,0x35,0x07,0xFF,0x88,0xFF,0xF0,0x0F,0x35,0xF4,0x5F,
+	0x27,0xF0,0x22,0xF5,0x4F,0x53,0x35,0x46,0x32,0x27,0x37,0x75,0x46,0x32,0xF5,0x3F,
+	0x44,0x3F,0x02,0x23,0xF2,0x5F,0x44,0xF3,0x50,0x1F,0xFC,0x47,0xFF,0x80,0x02,0xF5,
+	0x22,0x3F,0x34,0x14,0xF2,0x41,0x3F,0x43,0x12,0x35,0x46,0x32,0x57,0x37,0xA5,0x46,
+	0x32,0xF8,0x3F,0x74,0xF8,0x22,0x03,0xFF,0x88,0xFF,0xF0,0x3F,0x38,0xF4,0x8F,0x25,
+	0x23,0xF0,0x63,0xF8,0x4F,0x73,0xF8,0x23,0x54,0x6A,0x73,0x7A,0x54,0x63,0x2F,0x83,
+	0xF7,0x46,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x38,
+	0xF4,0x8F,0x25,0x23,0xF0,0x63,0xF8,0x4F,0x73,0xF8,0x23,0x54,0x6A,0x73,0x75,0x23,
+	0x54,0x63,0x21,0x3F,0x43,0x14,0xF2,0x41,0x3F,0x34,0x12,0x3F,0x02,0x26,0xF2,0x8F,
+	0x47,0xF3,0x50,0x03,0xFF,0x88,0xFF,0xF0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,
+	0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x2F,0x62,0xFF,0xF5,0x2F,0x83,0xF7,0x4F,
+	0x82,0x20,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,
+	0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x23,0x54,0x63,0x25,0x73,0x75,0x23,0x54,0x63,
+	0x21,0x3F,0x43,0x14,0xF2,0x41,0x3F,0x34,0x12,0x3F,0x02,0x26,0xF2,0x8F,0x47,0xF3,
+	0x50,0x03,0xFF,0x88,0xFF,0xF0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,
+	0x41,0x4F,0x24,0x13,0xF4,0x31,0x23,0x54,0x63,0x25,0x73,0x7A,0x54,0x63,0x2F,0x83,
+	0xF7,0x46,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x73,0xFF,0x38,0x04,0x22,0x82,0x24,
+	0x10,0x3F,0xFF,0xFF,0x80,0x0A,0x11,0x81,0x1A,0x10,0x2E,0x9F,0xC7,0x54,0x00,0xF0,
+	0x1F,0x32,0xF2,0x3F,0x22,0xF3,0x1F,0xF1,0x1F,0x32,0xF2,0x3F,0x22,0xF3,0x1F,0xF8,
+	0xF0,0x4F,0x22,0xF4,0x1F,0x32,0x27,0xFF,0xC0,0x25,0x46,0x47,0x37,0x45,0x46,0xFA,
+	0xF0,0x4F,0x22,0xF4,0x1F,0x32,0x57,0x1F,0xCB,0xA4,0x00,0x31,0xF4,0x2F,0x33,0xF3,
+	0x2F,0x41,0xFF,0xF2,0x1F,0x42,0xF3,0x3F,0x32,0xF4,0x1F,0xBF,0x04,0xF2,0x2F,0x41,
+	0xF3,0x20,0x03,0xFF,0x88,0x3F,0xC0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,
+	0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x2C,0x63,0x2F,0x07,0xF4,0x6F,0x31,0xF9,0x2F,
+	0x93,0xF7,0x4C,0x03,0xFF,0x88,0x3F,0xC0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,
+	0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x2C,0x63,0x2F,0x07,0x52,0xC6,0x32,0x13,
+	0x91,0x93,0x14,0x72,0x84,0x14,0x73,0x74,0x14,0x64,0x74,0x14,0xF2,0x41,0x3F,0x34,
+	0x12,0x3F,0x02,0x26,0xF2,0x8F,0x47,0xF3,0x50,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x38,
+	0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x23,0x54,
+	0x63,0x25,0x73,0x75,0x23,0x54,0x63,0x21,0x3F,0x43,0x14,0xF2,0x41,0x3F,0x34,0x12,
+	0xF5,0x22,0x05,0xFE,0x08,0x3F,0xD0,0x0F,0x35,0xF4,0x5F,0x27,0xF0,0x22,0xF5,0x48,
+	0x47,0x49,0x37,0x49,0x28,0x4A,0x19,0x3C,0x63,0x2C,0x7F,0x16,0x32,0xA1,0x93,0x92,
+	0x84,0x93,0x74,0x84,0x74,0xF4,0x43,0xF0,0x22,0x3F,0x25,0xF4,0x4F,0x35,0x03,0xFF,
+	0x88,0xFF,0xE0,0x3F,0x35,0xF4,0x5F,0x22,0x23,0xF0,0x33,0xF5,0x4F,0x43,0xF5,0x2F,
+	0xFE,0x2F,0x63,0xF5,0x4F,0x43,0xF5,0x23,0xF0,0x7F,0x25,0xF4,0x4F,0x32,0x05,0xFE,
+	0x08,0x3F,0xD0,0x0F,0x35,0xF4,0x5F,0x27,0xF0,0x22,0xF5,0x48,0x47,0x49,0x37,0x49,
+	0x28,0x4A,0x19,0x3F,0x62,0xFF,0xE2,0xA1,0x93,0x92,0x84,0x93,0x74,0x84,0x74,0xF4,
+	0x43,0xF0,0x22,0x3F,0x25,0xF4,0x4F,0x35,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x35,0xF4,
+	0x5F,0x22,0x23,0xF0,0x33,0xF5,0x4F,0x43,0xF5,0x23,0x54,0x67,0x73,0x72,0x23,0x54,
+	0x63,0x3F,0x54,0xF4,0x3F,0x52,0x3F,0x07,0xF2,0x5F,0x44,0xF3,0x20,0x03,0xFF,0x88,
+	0xFF,0xE0,0x3F,0x35,0xF4,0x5F,0x22,0x23,0xF0,0x33,0xF5,0x4F,0x43,0xF5,0x23,0x54,
+	0x67,0x73,0x72,0x23,0x54,0x63,0x3F,0x54,0xF4,0x3F,0x52,0xF6,0x03,0xFF,0x88,0xFF,
+	0xE0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x63,0xF8,0x4F,0x73,0xF8,0x2C,0x6F,0x57,
+	0x52,0xC6,0x32,0x13,0xF4,0x31,0x4F,0x24,0x13,0xF3,0x41,0x23,0xF0,0x22,0x6F,0x28,
+	0xF4,0x7F,0x35,0x1F,0xFC,0x47,0xFF,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,0x41,
+	0x3F,0x43,0x12,0x35,0x46,0x32,0x57,0x37,0x52,0x35,0x46,0x32,0x13,0xF4,0x31,0x4F,
+	0x24,0x13,0xF3,0x41,0x2F,0x52,0x20,0x05,0xFE,0x1C,0x3F,0xD0,0x0F,0x32,0xF4,0x2F,
+	0x24,0xF0,0xFF,0x04,0xF2,0x3F,0x22,0xF4,0x1F,0xF9,0x1F,0x32,0xF3,0x3F,0x14,0xFF,
+	0x1F,0x04,0xF2,0x2F,0x41,0xF3,0x20,0x3F,0xFC,0x47,0xFF,0x00,0xF7,0x2F,0x84,0xF8,
+	0x3F,0x92,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,0x13,0xF3,0x41,0x23,0xF0,0x22,
+	0x6F,0x28,0xF4,0x7F,0x35,0x05,0xD0,0x41,0x74,0x00,0x02,0xF3,0x3F,0x24,0xF1,0x4E,
+	0x11,0x4D,0x21,0x4C,0x31,0x4C,0x22,0x4C,0x13,0x4F,0x13,0xF2,0x23,0x5E,0x79,0x23,
+	0x5A,0x3F,0x24,0xF1,0x4C,0x13,0x4C,0x22,0x4C,0x31,0x4D,0x21,0x4E,0x11,0x4F,0x13,
+	0xF2,0x2F,0x30,0x1F,0xFC,0x47,0xFF,0x00,0x02,0xF6,0x3F,0x54,0xF4,0x3F,0x52,0xFF,
+	0xE2,0xF6,0x3F,0x54,0xF4,0x3F,0x52,0x3F,0x07,0xF2,0x5F,0x44,0xF3,0x20,0x00,0xC0,
+	0x41,0xFE,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,0x41,0x42,0x1B,0x12,0x41,0x42,
+	0x1A,0x22,0x41,0x42,0x29,0x22,0x41,0x42,0x28,0x32,0x41,0x42,0x37,0x32,0x41,0x42,
+	0x37,0x23,0x41,0x43,0x27,0x23,0x41,0x44,0x17,0x14,0x41,0x4F,0x24,0x13,0xF4,0x31,
+	0x2F,0x62,0xFC,0x2F,0x62,0x13,0x91,0x93,0x14,0x72,0x84,0x14,0x73,0x74,0x14,0x64,
+	0x74,0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,0x22,0x0A,0xE0,0x41,0x74,0x00,0x02,0xF5,
+	0x22,0x3F,0x34,0x14,0xF2,0x41,0x42,0x1E,0x41,0x42,0x2D,0x41,0x42,0x3C,0x41,0x43,
+	0x2C,0x41,0x44,0x1C,0x41,0x4F,0x24,0x13,0xF4,0x31,0x2F,0x62,0xFC,0x2F,0x62,0x13,
+	0xF4,0x31,0x4F,0x24,0x14,0xC1,0x44,0x14,0xC2,0x34,0x14,0xC3,0x24,0x14,0xD2,0x24,
+	0x14,0xE1,0x24,0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,0x22,0x03,0xFF,0x88,0xFF,0xE0,
+	0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,
+	0x2F,0x62,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,0x13,0xF3,0x41,0x23,0xF0,0x22,
+	0x6F,0x28,0xF4,0x7F,0x35,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x38,0xF4,0x8F,0x25,0x23,
+	0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x23,0x54,0x63,0x25,0x73,0x75,
+	0x23,0x54,0x66,0x3F,0x84,0xF7,0x3F,0x82,0xF9,0x03,0xFF,0x88,0x2E,0x80,0x3F,0x38,
+	0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x2F,0x62,
+	0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,0x14,0xC1,0x44,0x14,0xC2,0x34,0x14,0xC3,
+	0x24,0x14,0xD2,0x24,0x14,0xE1,0x24,0x14,0xF2,0x41,0x3F,0x34,0x12,0x3F,0x02,0x26,
+	0xF2,0x8F,0x47,0xF3,0x50,0x03,0xFF,0x88,0x2E,0x80,0x3F,0x38,0xF4,0x8F,0x25,0x23,
+	0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,0x23,0x54,0x63,0x25,0x73,0x75,
+	0x23,0x54,0x66,0x3F,0x84,0xF7,0x4C,0x19,0x4C,0x28,0x4C,0x37,0x4D,0x27,0x4E,0x17,
+	0x4F,0x73,0xF8,0x2F,0x90,0x01,0x5C,0x08,0x2E,0x90,0x3F,0x38,0xF4,0x8F,0x25,0x23,
+	0xF0,0x63,0xF8,0x4F,0x74,0x21,0xF4,0x42,0x2F,0x34,0x23,0xF2,0x43,0x2F,0x24,0x41,
+	0xF2,0x4F,0x73,0xF8,0x23,0x54,0x6A,0x73,0x7A,0x54,0x63,0x2F,0x83,0xF7,0x4F,0x21,
+	0x44,0xF2,0x23,0x4F,0x23,0x24,0xF3,0x22,0x4F,0x41,0x24,0xF7,0x46,0xF0,0x22,0x6F,
+	0x28,0xF4,0x7F,0x35,0x05,0xFE,0x1C,0x3F,0xC0,0x0F,0x32,0xF4,0x2F,0x24,0xF0,0xFF,
+	0x04,0xF2,0x3F,0x22,0xF4,0x1F,0xF9,0x1F,0x32,0xF3,0x3F,0x14,0x90,0x1F,0xFC,0x47,
+	0xFF,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,0x41,0x3F,0x43,0x12,0xF6,0x2F,0xC2,
+	0xF6,0x21,0x3F,0x43,0x14,0xF2,0x41,0x3F,0x34,0x12,0x3F,0x02,0x26,0xF2,0x8F,0x47,
+	0xF3,0x50,0x05,0xD0,0x40,0xEA,0x00,0x02,0xF3,0x3F,0x24,0xF1,0x4E,0x11,0x4D,0x21,
+	0x4C,0x31,0x4C,0x22,0x4C,0x13,0x4F,0x13,0xF2,0x2F,0xF8,0x2F,0x33,0xF2,0x4F,0x14,
+	0x41,0xB4,0x32,0xB4,0x23,0xB4,0x22,0xC4,0x21,0xD4,0xF1,0x3F,0x22,0xF3,0x0F,0xF0,
+	0x40,0x60,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,0x41,0x46,0x47,0x41,0x47,0x37,
+	0x41,0x47,0x28,0x41,0x39,0x19,0x31,0x2F,0x62,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,
+	0x24,0x14,0x41,0x71,0x44,0x14,0x32,0x72,0x34,0x14,0x23,0x72,0x34,0x14,0x23,0x73,
+	0x24,0x14,0x22,0x83,0x24,0x14,0x22,0x92,0x24,0x14,0x21,0xA2,0x24,0x14,0x21,0xB1,
+	0x24,0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,0x22,0x06,0x1F,0xC3,0x00,0x01,0xB1,0x11,
+	0xA2,0x12,0x92,0x12,0x83,0x13,0x73,0x13,0x72,0x32,0x72,0x41,0x71,0xF4,0x17,0x14,
+	0x27,0x22,0x37,0x22,0x37,0x31,0x28,0x31,0x29,0x21,0x1A,0x21,0x1B,0x11,0x06,0x1F,
+	0x0F,0xF0,0x01,0xB1,0x11,0xA2,0x12,0x92,0x12,0x83,0x13,0x73,0x13,0x72,0x32,0x72,
+	0x41,0x71,0xF8,0x1C,0x2C,0x3A,0x46,0x04,0xBA,0x7F,0x1D,0x50,0x0F,0x32,0xF4,0x2F,
+	0x24,0xF0,0xFF,0x81,0xF3,0x2F,0x23,0xF2,0x2F,0x31,0xFF,0x11,0xF3,0x2F,0x23,0xF2,
+	0x2F,0x31,0xFF,0x8F,0x04,0xF2,0x2F,0x41,0xF3,0x20,0x3F,0xFF,0xFF,0x80,0x0A,0x11,
+	0x81,0x1A,0x10,0x57,0x1F,0xCB,0xA0,0x01,0xD2,0xC3,0xC2,0xD1,0xFF,0x51,0xD2,0xC3,
+	0xC2,0xD1,0x10,0x3F,0xFF,0xFF,0x80,0x0A,0x11,0x81,0x1A,0x10,0x0A,0xE0,0x02,0x83,
+	0x74,0x64,0x21,0x34,0x22,0x24,0x23,0x14,0x32,0x14,0x41,0x14,0x63,0x72,0x80,0x00,
+	0x2F,0x04,0xF2,0x2F,0x41,0xF3,0x20,0x57,0x00,0x01,0x32,0x23,0x22,0x31,0x10,0x03,
+	0xFF,0x88,0xFF,0xE0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,
+	0x24,0x13,0xF4,0x31,0x23,0x54,0x63,0x25,0x73,0x75,0x23,0x54,0x63,0x21,0x3F,0x43,
+	0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,0x22,0x05,0xFE,0x08,0x3F,0xD0,0x0F,0x35,0xF4,
+	0x5F,0x27,0xF0,0x22,0xF5,0x48,0x47,0x49,0x37,0x49,0x28,0x4A,0x19,0x3C,0x63,0x2C,
+	0x7F,0x16,0x32,0xA1,0x93,0x92,0x84,0x93,0x74,0x84,0x74,0xF4,0x43,0xF0,0x22,0x3F,
+	0x25,0xF4,0x4F,0x35,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x35,0xF4,0x5F,0x22,0x23,0xF0,
+	0x33,0xF5,0x4F,0x43,0xF5,0x2F,0xFE,0x2F,0x63,0xF5,0x4F,0x43,0xF5,0x23,0xF0,0x7F,
+	0x25,0xF4,0x4F,0x32,0x05,0xFE,0x08,0x3F,0xD0,0x0F,0x35,0xF4,0x5F,0x27,0xF0,0x22,
+	0xF5,0x48,0x47,0x49,0x37,0x49,0x28,0x4A,0x19,0x3F,0x62,0xFF,0xE2,0xA1,0x93,0x92,
+	0x84,0x93,0x74,0x84,0x74,0xF4,0x43,0xF0,0x22,0x3F,0x25,0xF4,0x4F,0x35,0x03,0xFF,
+	0x88,0xFF,0xE0,0x3F,0x35,0xF4,0x5F,0x22,0x23,0xF0,0x33,0xF5,0x4F,0x43,0xF5,0x23,
+	0x54,0x67,0x73,0x72,0x23,0x54,0x63,0x3F,0x54,0xF4,0x3F,0x52,0x3F,0x07,0xF2,0x5F,
+	0x44,0xF3,0x20,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x35,0xF4,0x5F,0x22,0x23,0xF0,0x33,
+	0xF5,0x4F,0x43,0xF5,0x23,0x54,0x67,0x73,0x72,0x23,0x54,0x63,0x3F,0x54,0xF4,0x3F,
+	0x52,0xF6,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x63,0xF8,
+	0x4F,0x73,0xF8,0x2C,0x6F,0x57,0x52,0xC6,0x32,0x13,0xF4,0x31,0x4F,0x24,0x13,0xF3,
+	0x41,0x23,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x1F,0xFC,0x47,0xFF,0x00,0x02,0xF5,
+	0x22,0x3F,0x34,0x14,0xF2,0x41,0x3F,0x43,0x12,0x35,0x46,0x32,0x57,0x37,0x52,0x35,
+	0x46,0x32,0x13,0xF4,0x31,0x4F,0x24,0x13,0xF3,0x41,0x2F,0x52,0x20,0x05,0xFE,0x1C,
+	0x3F,0xD0,0x0F,0x32,0xF4,0x2F,0x24,0xF0,0xFF,0x04,0xF2,0x3F,0x22,0xF4,0x1F,0xF9,
+	0x1F,0x32,0xF3,0x3F,0x14,0xFF,0x1F,0x04,0xF2,0x2F,0x41,0xF3,0x20,0x3F,0xFC,0x47,
+	0xFF,0x00,0xF7,0x2F,0x84,0xF8,0x3F,0x92,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,
+	0x13,0xF3,0x41,0x23,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x05,0xD0,0x41,0x74,0x00,
+	0x02,0xF3,0x3F,0x24,0xF1,0x4E,0x11,0x4D,0x21,0x4C,0x31,0x4C,0x22,0x4C,0x13,0x4F,
+	0x13,0xF2,0x23,0x5E,0x79,0x23,0x5A,0x3F,0x24,0xF1,0x4C,0x13,0x4C,0x22,0x4C,0x31,
+	0x4D,0x21,0x4E,0x11,0x4F,0x13,0xF2,0x2F,0x30,0x1F,0xFC,0x47,0xFF,0x00,0x02,0xF6,
+	0x3F,0x54,0xF4,0x3F,0x52,0xFF,0xE2,0xF6,0x3F,0x54,0xF4,0x3F,0x52,0x3F,0x07,0xF2,
+	0x5F,0x44,0xF3,0x20,0x00,0xC0,0x41,0xFE,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,
+	0x41,0x42,0x1B,0x12,0x41,0x42,0x1A,0x22,0x41,0x42,0x29,0x22,0x41,0x42,0x28,0x32,
+	0x41,0x42,0x37,0x32,0x41,0x42,0x37,0x23,0x41,0x43,0x27,0x23,0x41,0x44,0x17,0x14,
+	0x41,0x4F,0x24,0x13,0xF4,0x31,0x2F,0x62,0xFC,0x2F,0x62,0x13,0x91,0x93,0x14,0x72,
+	0x84,0x14,0x73,0x74,0x14,0x64,0x74,0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,0x22,0x0A,
+	0xE0,0x41,0x74,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,0x41,0x42,0x1E,0x41,0x42,
+	0x2D,0x41,0x42,0x3C,0x41,0x43,0x2C,0x41,0x44,0x1C,0x41,0x4F,0x24,0x13,0xF4,0x31,
+	0x2F,0x62,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,0x14,0xC1,0x44,0x14,0xC2,0x34,
+	0x14,0xC3,0x24,0x14,0xD2,0x24,0x14,0xE1,0x24,0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,
+	0x22,0x03,0xFF,0x88,0xFF,0xE0,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,
+	0x41,0x4F,0x24,0x13,0xF4,0x31,0x2F,0x62,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,
+	0x13,0xF3,0x41,0x23,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x03,0xFF,0x88,0xFF,0xE0,
+	0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,
+	0x23,0x54,0x63,0x25,0x73,0x75,0x23,0x54,0x66,0x3F,0x84,0xF7,0x3F,0x82,0xF9,0x03,
+	0xFF,0x88,0x2E,0x80,0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,
+	0x24,0x13,0xF4,0x31,0x2F,0x62,0xFC,0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,0x14,0xC1,
+	0x44,0x14,0xC2,0x34,0x14,0xC3,0x24,0x14,0xD2,0x24,0x14,0xE1,0x24,0x14,0xF2,0x41,
+	0x3F,0x34,0x12,0x3F,0x02,0x26,0xF2,0x8F,0x47,0xF3,0x50,0x03,0xFF,0x88,0x2E,0x80,
+	0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x22,0x23,0xF3,0x41,0x4F,0x24,0x13,0xF4,0x31,
+	0x23,0x54,0x63,0x25,0x73,0x75,0x23,0x54,0x66,0x3F,0x84,0xF7,0x4C,0x19,0x4C,0x28,
+	0x4C,0x37,0x4D,0x27,0x4E,0x17,0x4F,0x73,0xF8,0x2F,0x90,0x01,0x5C,0x08,0x2E,0x90,
+	0x3F,0x38,0xF4,0x8F,0x25,0x23,0xF0,0x63,0xF8,0x4F,0x74,0x21,0xF4,0x42,0x2F,0x34,
+	0x23,0xF2,0x43,0x2F,0x24,0x41,0xF2,0x4F,0x73,0xF8,0x23,0x54,0x6A,0x73,0x7A,0x54,
+	0x63,0x2F,0x83,0xF7,0x4F,0x21,0x44,0xF2,0x23,0x4F,0x23,0x24,0xF3,0x22,0x4F,0x41,
+	0x24,0xF7,0x46,0xF0,0x22,0x6F,0x28,0xF4,0x7F,0x35,0x05,0xFE,0x1C,0x3F,0xC0,0x0F,
+	0x32,0xF4,0x2F,0x24,0xF0,0xFF,0x04,0xF2,0x3F,0x22,0xF4,0x1F,0xF9,0x1F,0x32,0xF3,
+	0x3F,0x14,0x90,0x1F,0xFC,0x47,0xFF,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,0x41,
+	0x3F,0x43,0x12,0xF6,0x2F,0xC2,0xF6,0x21,0x3F,0x43,0x14,0xF2,0x41,0x3F,0x34,0x12,
+	0x3F,0x02,0x26,0xF2,0x8F,0x47,0xF3,0x50,0x05,0xD0,0x40,0xEA,0x00,0x02,0xF3,0x3F,
+	0x24,0xF1,0x4E,0x11,0x4D,0x21,0x4C,0x31,0x4C,0x22,0x4C,0x13,0x4F,0x13,0xF2,0x2F,
+	0xF8,0x2F,0x33,0xF2,0x4F,0x14,0x41,0xB4,0x32,0xB4,0x23,0xB4,0x22,0xC4,0x21,0xD4,
+	0xF1,0x3F,0x22,0xF3,0x0F,0xF0,0x40,0x60,0x00,0x02,0xF5,0x22,0x3F,0x34,0x14,0xF2,
+	0x41,0x46,0x47,0x41,0x47,0x37,0x41,0x47,0x28,0x41,0x39,0x19,0x31,0x2F,0x62,0xFC,
+	0x2F,0x62,0x13,0xF4,0x31,0x4F,0x24,0x14,0x41,0x71,0x44,0x14,0x32,0x72,0x34,0x14,
+	0x23,0x72,0x34,0x14,0x23,0x73,0x24,0x14,0x22,0x83,0x24,0x14,0x22,0x92,0x24,0x14,
+	0x21,0xA2,0x24,0x14,0x21,0xB1,0x24,0x14,0xF2,0x41,0x3F,0x34,0x12,0xF5,0x22,0x06,
+	0x1F,0xC3,0x00,0x01,0xB1,0x11,0xA2,0x12,0x92,0x12,0x83,0x13,0x73,0x13,0x72,0x32,
+	0x72,0x41,0x71,0xF4,0x17,0x14,0x27,0x22,0x37,0x22,0x37,0x31,0x28,0x31,0x29,0x21,
+	0x1A,0x21,0x1B,0x11,0x06,0x1F,0x0F,0xF0,0x01,0xB1,0x11,0xA2,0x12,0x92,0x12,0x83,
+	0x13,0x73,0x13,0x72,0x32,0x72,0x41,0x71,0xF8,0x1C,0x2C,0x3A,0x46,0x04,0xBA,0x7F,
+	0x1D,0x50,0x0F,0x32,0xF4,0x2F,0x24,0xF0,0xFF,0x81,0xF3,0x2F,0x23,0xF2,0x2F,0x31,
+	0xFF,0x11,0xF3,0x2F,0x23,0xF2,0x2F,0x31,0xFF,0x8F,0x04,0xF2,0x2F,0x41,0xF3,0x20,
+	0x3F,0xFF,0xFF,0x80,0x0A,0x11,0x81,0x1A,0x10,0x7F,0x87,0x0F,0xF0,0x04,0x23,0x22,
+	0x41,0x91,0x32,0x33,0x14,0x10,0x3F,0xFF,0xFF,0x80,0x0A,0x11,0x81,0x1A,0x10,
+};
+const GFXglyph DSEG14_Classic_Mini_Regular_40_rleGlyphs[] = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   1,   1,   9,    0,    0 }, // ' '
+	  {     2,   1,   1,  34,    0,    0 }, // '!'
+	  {     4,  15,  16,  34,    4,  -37 }, // '"'
+	  {    19,  11,  26,  16,    1,  -26 }, // '#'
+	  {    28,  26,  40,  34,    4,  -40 }, // '$'
+	  {    76,  26,  34,  34,    4,  -37 }, // '%'
+	  {   151,  23,  40,  34,    7,  -40 }, // '&'
+	  {   218,   5,  12,  34,   14,  -34 }, // "'"
+	  {   225,   4,  28,  34,   20,  -34 }, // '('
+	  {   240,   4,  28,  34,   10,  -34 }, // ')'
+	  {   255,  20,  28,  34,    7,  -34 }, // '*'
+	  {   319,  20,  28,  34,    7,  -34 }, // '+'
+	  {   341,   4,  10,  34,   10,  -16 }, // ','
+	  {   349,  20,   4,  34,    7,  -22 }, // '-'
+	  {   357,   5,   5,   1,   -2,   -5 }, // '.'
+	  {   362,  14,  28,  34,   10,  -34 }, // '/'
+	  {   377,  26,  40,  34,    4,  -40 }, // '0'
+	  {   454,   5,  34,  34,   25,  -37 }, // '1'
+	  {   468,  26,  40,  34,    4,  -40 }, // '2'
+	  {   503,  23,  40,  34,    7,  -40 }, // '3'
+	  {   537,  26,  34,  34,    4,  -37 }, // '4'
+	  {   566,  26,  40,  34,    4,  -40 }, // '5'
+	  {   601,  26,  40,  34,    4,  -40 }, // '6'
+	  {   643,  26,  37,  34,    4,  -40 }, // '7'
+	  {   674,  26,  40,  34,    4,  -40 }, // '8'
+	  {   721,  26,  40,  34,    4,  -40 }, // '9'
+	  {   761,   5,  21,   9,    2,  -30 }, // ':'
+	  {   769,  11,  26,  16,    1,  -26 }, // ';'
+	  {   778,  20,  34,  34,    7,  -34 }, // '<'
+	  {   806,  20,  22,  34,    7,  -22 }, // '='
+	  {   822,  20,  34,  34,    7,  -34 }, // '>'
+	  {   850,  26,  34,  34,    4,  -40 }, // '?'
+	  {   883,  26,  40,  34,    4,  -40 }, // '@'
+	  {   937,  26,  37,  34,    4,  -40 }, // 'A'
+	  {   978,  23,  40,  34,    7,  -40 }, // 'B'
+	  {  1022,  23,  40,  34,    4,  -40 }, // 'C'
+	  {  1054,  23,  40,  34,    7,  -40 }, // 'D'
+	  {  1096,  23,  40,  34,    4,  -40 }, // 'E'
+	  {  1133,  23,  37,  34,    4,  -40 }, // 'F'
+	  {  1164,  26,  40,  34,    4,  -40 }, // 'G'
+	  {  1203,  26,  34,  34,    4,  -37 }, // 'H'
+	  {  1239,  20,  40,  34,    7,  -40 }, // 'I'
+	  {  1271,  26,  37,  34,    4,  -37 }, // 'J'
+	  {  1301,  20,  34,  34,    4,  -37 }, // 'K'
+	  {  1347,  23,  37,  34,    4,  -37 }, // 'L'
+	  {  1374,  26,  34,  34,    4,  -37 }, // 'M'
+	  {  1449,  26,  34,  34,    4,  -37 }, // 'N'
+	  {  1515,  26,  40,  34,    4,  -40 }, // 'O'
+	  {  1557,  26,  37,  34,    4,  -40 }, // 'P'
+	  {  1593,  26,  40,  34,    4,  -40 }, // 'Q'
+	  {  1653,  26,  37,  34,    4,  -40 }, // 'R'
+	  {  1701,  26,  40,  34,    4,  -40 }, // 'S'
+	  {  1764,  20,  34,  34,    7,  -40 }, // 'T'
+	  {  1789,  26,  37,  34,    4,  -37 }, // 'U'
+	  {  1826,  20,  34,  34,    4,  -37 }, // 'V'
+	  {  1870,  26,  34,  34,    4,  -37 }, // 'W'
+	  {  1945,  14,  28,  34,   10,  -34 }, // 'X'
+	  {  1982,  14,  28,  34,   10,  -34 }, // 'Y'
+	  {  2007,  20,  40,  34,    7,  -40 }, // 'Z'
+	  {  2042,  11,  26,  16,    1,  -26 }, // '['
+	  {  2051,  14,  28,  34,   10,  -34 }, // '\\'
+	  {  2067,  11,  26,  16,    1,  -26 }, // ']'
+	  {  2076,  10,  16,  34,    4,  -37 }, // '^'
+	  {  2095,  20,   4,  34,    7,   -4 }, // '_'
+	  {  2103,   4,  10,  34,   10,  -34 }, // '`'
+	  {  2111,  26,  37,  34,    4,  -40 }, // 'a'
+	  {  2152,  23,  40,  34,    7,  -40 }, // 'b'
+	  {  2196,  23,  40,  34,    4,  -40 }, // 'c'
+	  {  2228,  23,  40,  34,    7,  -40 }, // 'd'
+	  {  2270,  23,  40,  34,    4,  -40 }, // 'e'
+	  {  2307,  23,  37,  34,    4,  -40 }, // 'f'
+	  {  2338,  26,  40,  34,    4,  -40 }, // 'g'
+	  {  2377,  26,  34,  34,    4,  -37 }, // 'h'
+	  {  2413,  20,  40,  34,    7,  -40 }, // 'i'
+	  {  2445,  26,  37,  34,    4,  -37 }, // 'j'
+	  {  2475,  20,  34,  34,    4,  -37 }, // 'k'
+	  {  2521,  23,  37,  34,    4,  -37 }, // 'l'
+	  {  2548,  26,  34,  34,    4,  -37 }, // 'm'
+	  {  2623,  26,  34,  34,    4,  -37 }, // 'n'
+	  {  2689,  26,  40,  34,    4,  -40 }, // 'o'
+	  {  2731,  26,  37,  34,    4,  -40 }, // 'p'
+	  {  2767,  26,  40,  34,    4,  -40 }, // 'q'
+	  {  2827,  26,  37,  34,    4,  -40 }, // 'r'
+	  {  2875,  26,  40,  34,    4,  -40 }, // 's'
+	  {  2938,  20,  34,  34,    7,  -40 }, // 't'
+	  {  2963,  26,  37,  34,    4,  -37 }, // 'u'
+	  {  3000,  20,  34,  34,    4,  -37 }, // 'v'
+	  {  3044,  26,  34,  34,    4,  -37 }, // 'w'
+	  {  3119,  14,  28,  34,   10,  -34 }, // 'x'
+	  {  3156,  14,  28,  34,   10,  -34 }, // 'y'
+	  {  3181,  20,  40,  34,    7,  -40 }, // 'z'
+	  {  3216,  11,  26,  16,    1,  -26 }, // '{'
+	  {  3225,   5,  28,  34,   14,  -34 }, // '|'
+	  {  3238,  11,  26,  16,    1,  -26 }, // '}'
+};
+const GFXfont DSEG14_Classic_Mini_Regular_40_rle = {
+(uint8_t  *)DSEG14_Classic_Mini_Regular_40_rleBitmaps,(GFXglyph *)DSEG14_Classic_Mini_Regular_40_rleGlyphs,0x20, 0x7D, 44, OBD_FONT_RLE};
@@ -0,0 +1,109 @@
+// Generated by fontc.py from Roboto_Black_80.h, do not edit
+const uint8_t Roboto_Black_80_priceBitmaps[] = {
+	0x7F,0x00,0x00,0xC0,0x00,0x00,0x28,0x10,0x0F,0xE0,0xF3,0x7F,0xF1,0xBF,0xCF,0x3F,
+	0x6F,0x7F,0x2F,0xAF,0x0F,0xCD,0xFE,0xBF,0xF1,0xAF,0xF2,0x8F,0xF4,0x6F,0xF5,0x6F,
+	0x05,0xF0,0x6E,0x8E,0x4E,0x9E,0x4E,0xAD,0x4E,0xAE,0x3D,0xCD,0x3E,0xBD,0x3E,0xFD,
+	0xDF,0xDE,0xFC,0xF0,0xFC,0xF1,0xFA,0xF3,0xF9,0xF4,0xF8,0xF5,0xF7,0xF6,0xF6,0xF7,
+	0xF5,0xF8,0xF5,0xF7,0xF5,0xF7,0xF6,0xF6,0xF8,0xF4,0xF9,0xF3,0xFA,0xF2,0xFB,0xF0,
+	0xFC,0xF0,0xFC,0xEF,0xDD,0x2D,0xDD,0x2D,0xDE,0x1E,0xCE,0x2D,0xCE,0x2E,0xBD,0x3F,
+	0x09,0xE4,0xF1,0x5F,0x14,0xFF,0x75,0xFF,0x57,0xFF,0x39,0xFF,0x1B,0xFE,0xDF,0xCF,
+	0x1F,0x8F,0x5F,0x4F,0xBC,0xFF,0x26,0xF2,0x00,0x04,0x00,0x01,0x00,0x09,0x00,0x00,
+	0x88,0xFF,0xCE,0xFF,0x8F,0x2F,0xF5,0xF4,0xFF,0x3F,0x6F,0xF1,0xF7,0xFF,0x1F,0x8C,
+	0x1F,0x1A,0x4A,0xB4,0xE9,0x69,0xB6,0xC8,0x89,0x99,0xA8,0x89,0x98,0xB8,0x89,0x88,
+	0xC8,0x89,0x78,0xD8,0x89,0x68,0xE8,0x89,0x59,0xE8,0x89,0x58,0xF0,0x96,0xA4,0x8F,
+	0x1A,0x4A,0x58,0xF2,0xF8,0x48,0xF3,0xF7,0x49,0xF4,0xF6,0x48,0xF6,0xF4,0x48,0xF8,
+	0xF2,0x58,0xF9,0xE6,0x8F,0xD9,0x78,0xFF,0xF0,0x8F,0xFE,0x8F,0xFE,0x9F,0xFE,0x8F,
+	0xFE,0x8F,0xFE,0x8F,0xFE,0x88,0x8F,0xE8,0x5E,0xFA,0x85,0xF2,0xF8,0x84,0xF4,0xF6,
+	0x84,0xF6,0xF4,0x84,0xF7,0xF4,0x84,0xF8,0xF2,0x84,0xA4,0xAF,0x19,0x49,0x6A,0xF0,
+	0x85,0x88,0x9E,0x86,0x88,0x9D,0x87,0x88,0x9C,0x88,0x88,0x9B,0x89,0x88,0x9A,0x99,
+	0x88,0x9A,0x8A,0x97,0x9B,0x6B,0xA5,0x9E,0x4C,0xF8,0xF1,0x1D,0xF7,0xFF,0x2F,0x6F,
+	0xF3,0xF4,0xFF,0x5F,0x2F,0xF7,0xEF,0xFC,0x99,0x7F,0xDC,0xA8,0x00,0x4B,0x5A,0x5B,
+	0x5A,0x5A,0x5A,0x5A,0x78,0xA5,0xD2,0x90,0x7F,0xC0,0x0F,0x81,0x07,0x80,0x46,0x7A,
+	0x4C,0x2D,0x2E,0x1D,0x3C,0x4A,0x76,0x50,0x14,0x92,0x54,0x92,0x54,0x92,0x54,0x90,
+	0xF4,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,
+	0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,
+	0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,
+	0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF5,0xAF,0x59,0xF6,0x00,0x05,0xCF,
+	0xFF,0xFE,0x7A,0x10,0x00,0xF0,0xAF,0xDF,0x1F,0x8F,0x5F,0x4F,0x9F,0x1F,0xBE,0xFD,
+	0xCF,0xF0,0xAF,0xF1,0xAF,0xF2,0x8F,0xF4,0x7E,0x5F,0x06,0xE8,0xE5,0xDA,0xD4,0xDC,
+	0xD2,0xEC,0xD2,0xDE,0xD1,0xDD,0xE2,0xDC,0xD4,0xDA,0xD5,0xE8,0xE6,0xF0,0x4F,0x07,
+	0xFF,0x48,0xFF,0x2A,0xFF,0x0C,0xFD,0xEF,0xBF,0x1F,0x9F,0x4F,0x5F,0x8F,0x1F,0xDA,
+	0xF1,0x00,0x3E,0x0F,0xFF,0xFF,0xFF,0xFF,0x80,0xF9,0x3F,0x76,0xF5,0x8F,0x2B,0xEE,
+	0xBF,0x28,0xF5,0x6F,0x73,0xFA,0x1F,0xC1,0xC1,0xE1,0x94,0xE1,0x67,0xE1,0x2B,0xEE,
+	0xE1,0x00,0x40,0xAA,0x80,0x00,0x00,0x3F,0xC0,0xF1,0xAF,0xDF,0x3F,0x7F,0x7F,0x3F,
+	0xBF,0x0F,0xDD,0xFF,0x0B,0xFF,0x29,0xFF,0x38,0xFF,0x56,0xF1,0x5F,0x15,0xE8,0xF0,
+	0x4E,0xAE,0x4E,0xBD,0x4D,0xCE,0x2E,0xCE,0x2D,0xDE,0xFD,0xDF,0xDE,0xFC,0xEF,0xCE,
+	0xFC,0xF0,0xFC,0xEF,0xCE,0xFC,0xF0,0xFB,0xF0,0xFB,0xF0,0xFB,0xF0,0xFB,0xF1,0xFA,
+	0xF1,0xFA,0xF1,0xFB,0xF0,0xFB,0xF0,0xFB,0xF0,0xFB,0xF0,0xFB,0xF0,0xFB,0xF0,0xFB,
+	0xF0,0xFB,0xF0,0xFB,0xF1,0xFA,0xF1,0xFA,0xF1,0xFA,0xF1,0xFA,0xFF,0x92,0xFF,0xA1,
+	0x00,0x00,0xE0,0x00,0x05,0xD0,0x00,0x00,0xF0,0xBF,0xCF,0x3F,0x7F,0x8F,0x2F,0xCE,
+	0xFE,0xCF,0xF1,0xAF,0xF3,0x8F,0xF5,0x6F,0xF6,0x6F,0xF7,0x4F,0x16,0xF1,0x4F,0x09,
+	0xF0,0x3E,0xBE,0x3D,0xCE,0x3D,0xDD,0xFE,0xDF,0xDE,0xFD,0xDF,0xDE,0xFB,0xF0,0xF2,
+	0xF9,0xF3,0xF8,0xF4,0xF7,0xF5,0xF6,0xF6,0xF4,0xF8,0xF5,0xF7,0xF7,0xF5,0xF8,0xF4,
+	0xF9,0xF3,0xFA,0xFC,0xF1,0xFD,0xEF,0xEE,0xFE,0xDF,0xF0,0xD1,0xDF,0x0D,0x1D,0xEE,
+	0x1E,0xDE,0x1F,0x0B,0xE3,0xF0,0x9F,0x03,0xF1,0x6F,0x23,0xFF,0x85,0xFF,0x76,0xFF,
+	0x57,0xFF,0x49,0xFF,0x2B,0xFF,0x0E,0xFB,0xF3,0xF8,0xF6,0xF3,0xFD,0xAF,0x20,0x14,
+	0xA4,0x80,0x25,0x0B,0xBB,0xFF,0x80,0xF8,0xDF,0xEE,0xFD,0xF0,0xFC,0xF1,0xFB,0xF2,
+	0xFA,0xF3,0xF9,0xF4,0xF8,0xF5,0xF7,0xF6,0xF6,0xF7,0xF5,0xF8,0xF4,0xF9,0xF4,0xA1,
+	0xDF,0x3B,0x1D,0xF2,0xB2,0xDF,0x2A,0x3D,0xF1,0xB3,0xDF,0x1A,0x4D,0xF0,0xB4,0xDE,
+	0xB5,0xDD,0xB6,0xDC,0xB7,0xDB,0xB8,0xDA,0xB9,0xD9,0xC9,0xD9,0xBA,0xD8,0xFF,0xB1,
+	0xFF,0xC2,0xFF,0xBF,0x9D,0x70,0x7F,0x9F,0xB0,0x00,0x32,0x80,0x40,0x00,0x4F,0xF4,
+	0x6F,0xF5,0x6C,0xFD,0xCF,0xEC,0x49,0xF1,0xC1,0xF0,0xDF,0xF0,0xBF,0xF2,0x9F,0xF3,
+	0x8F,0xF4,0x6F,0xF5,0x6F,0xF6,0x5F,0xF7,0x4E,0x7F,0x18,0x8B,0xED,0x2D,0xEF,0xCE,
+	0xFD,0xDF,0xDE,0xFD,0xDF,0xCE,0x1D,0xDE,0x1D,0xDD,0x2E,0xCD,0x2E,0xBE,0x3E,0xAE,
+	0x3F,0x08,0xE4,0xF1,0x5F,0x15,0xFF,0x57,0xFF,0x39,0xFF,0x2A,0xFF,0x0C,0xFD,0xF0,
+	0xF9,0xF3,0xF7,0xF7,0xF2,0xFC,0xAF,0x10,0x00,0x00,0x10,0x24,0x5B,0x92,0x00,0x00,
+	0xF9,0x8F,0xF0,0xCF,0xDE,0xFB,0xF1,0xF9,0xF3,0xF7,0xF5,0xF6,0xF6,0xF5,0xF7,0xF4,
+	0xF8,0xF3,0xF9,0xF2,0xF5,0xF6,0xF2,0xF9,0xF1,0xFB,0xF0,0xFB,0xF0,0xFC,0xEF,0xCE,
+	0xFD,0xDF,0xDD,0xFE,0xD6,0x8E,0xD4,0xEB,0xD2,0xF2,0xAD,0x1F,0x58,0xFF,0x56,0xFF,
+	0x75,0xFF,0x84,0xFF,0x93,0xF2,0x6F,0x13,0xF0,0xAF,0x02,0xEC,0xE2,0xDE,0xE1,0xDF,
+	0x0D,0x2C,0xF0,0xD2,0xDD,0xE2,0xDD,0xD4,0xDB,0xE4,0xE9,0xE6,0xF0,0x5F,0x16,0xFF,
+	0x58,0xFF,0x49,0xFF,0x2B,0xFF,0x0D,0xFD,0xF0,0xFB,0xF2,0xF9,0xF5,0xF5,0xF9,0xF1,
+	0xFE,0xAF,0x10,0x7F,0x48,0x55,0xAA,0x14,0x14,0x2A,0x00,0x0F,0xFB,0x1F,0xFA,0xFE,
+	0xDF,0xDD,0xFE,0xCF,0xED,0xFE,0xCF,0xED,0xFD,0xDF,0xDD,0xFD,0xDF,0xDD,0xFD,0xDF,
+	0xDD,0xFD,0xEF,0xDD,0xFD,0xEF,0xDD,0xFD,0xDF,0xDE,0xFD,0xDF,0xDE,0xFD,0xDF,0xDE,
+	0xFC,0xEF,0xDD,0xFD,0xEF,0xDD,0xFD,0xEF,0xCE,0xFC,0xEF,0xDD,0xFD,0xEF,0x70,0x00,
+	0x03,0xD8,0x00,0x04,0xCC,0x24,0x00,0xF0,0xAF,0xCF,0x3F,0x6F,0x7F,0x2F,0xBE,0xFD,
+	0xCF,0xF0,0xAF,0xF2,0x8F,0xF3,0x8F,0xF4,0x6F,0xF6,0x5F,0x14,0xF1,0x5E,0x8E,0x5D,
+	0xAD,0x4E,0xAE,0x4D,0xAD,0x6D,0x8D,0x7F,0x05,0xE8,0xFF,0x2A,0xFF,0x0C,0xFD,0xEF,
+	0xBF,0x2F,0x8F,0x2F,0x9F,0x0F,0xDC,0xFF,0x0A,0xFF,0x28,0xFF,0x46,0xF0,0x6E,0x6E,
+	0x8E,0x4E,0xAE,0x3D,0xCD,0x2E,0xCD,0x2D,0xED,0x1D,0xDE,0x1E,0xCE,0x2E,0xAE,0x3F,
+	0x08,0xF0,0x3F,0x16,0xF1,0x4F,0xF6,0x6F,0xF4,0x8F,0xF2,0xBF,0xDE,0xFB,0xF2,0xF8,
+	0xF5,0xF3,0xFB,0xCF,0x00,0x00,0x01,0x4E,0xD1,0x20,0x10,0x00,0x00,0xF0,0x9F,0xEF,
+	0x0F,0x9F,0x4F,0x6F,0x7F,0x2F,0xAF,0x0F,0xCD,0xFE,0xBF,0xF1,0xAF,0xF2,0x8F,0xF3,
+	0x7F,0x14,0xF0,0x6E,0x8D,0x6E,0x9D,0x4E,0xAD,0x4D,0xCD,0x2E,0xCD,0x2D,0xDD,0x2D,
+	0xED,0x1E,0xDD,0x2E,0xBE,0x2F,0x09,0xF0,0x3F,0x15,0xF2,0x3F,0xF8,0x4F,0xF7,0x5F,
+	0xF5,0x7F,0xF4,0x8F,0xF3,0xAF,0x21,0xDC,0xD3,0xCF,0x18,0x5C,0xFD,0xDF,0xDC,0xFD,
+	0xDF,0xCD,0xFC,0xEF,0xAF,0x0F,0x9F,0x1F,0x7F,0x4F,0x1F,0x9F,0x2F,0x8F,0x3F,0x7F,
+	0x4F,0x6F,0x5F,0x4F,0x7F,0x3F,0x8F,0x1F,0xAE,0xFC,0xBF,0xF0,0x7F,0xA0,0x07,0x83,
+	0xFF,0xFE,0x0F,0x00,0x46,0x7A,0x4C,0x2D,0x2E,0x1D,0x3C,0x4A,0x76,0xF9,0x67,0xA4,
+	0xC2,0xD2,0xE1,0xD3,0xC4,0xA7,0x65,
+};
+const GFXglyph Roboto_Black_80_priceGlyphs[] = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,  41,  75,  47,    3,  -66 }, // '$'
+	  {   120,  53,  59,  60,    4,  -58 }, // '%'
+	  {     0,   0,   0,   0,    0,    0 }, // '&'
+	  {     0,   0,   0,   0,    0,    0 }, // "'"
+	  {     0,   0,   0,   0,    0,    0 }, // '('
+	  {     0,   0,   0,   0,    0,    0 }, // ')'
+	  {     0,   0,   0,   0,    0,    0 }, // '*'
+	  {     0,   0,   0,   0,    0,    0 }, // '+'
+	  {   281,  16,  25,  23,    2,  -10 }, // ','
+	  {   296,  24,  10,  37,    6,  -30 }, // '-'
+	  {   300,  15,  13,  25,    5,  -13 }, // '.'
+	  {   312,  30,  62,  29,   -1,  -57 }, // '/'
+	  {   381,  41,  59,  47,    3,  -58 }, // '0'
+	  {   449,  28,  57,  47,    6,  -57 }, // '1'
+	  {   481,  42,  58,  47,    2,  -58 }, // '2'
+	  {   576,  42,  59,  47,    2,  -58 }, // '3'
+	  {   687,  43,  57,  47,    2,  -57 }, // '4'
+	  {   758,  41,  58,  47,    3,  -57 }, // '5'
+	  {   840,  42,  59,  47,    3,  -58 }, // '6'
+	  {   947,  42,  57,  47,    2,  -57 }, // '7'
+	  {  1007,  41,  59,  47,    3,  -58 }, // '8'
+	  {  1109,  41,  59,  47,    3,  -58 }, // '9'
+	  {  1214,  15,  44,  25,    5,  -44 }, // ':'
+};
+const GFXfont Roboto_Black_80_price = {
+(uint8_t  *)Roboto_Black_80_priceBitmaps,(GFXglyph *)Roboto_Black_80_priceGlyphs,0x24, 0x3A, 95, OBD_FONT_RLE};
@@ -28,6 +28,9 @@
 #define EPD_MOSI	GPIO_PB6
 #define EPD_ENABLE	GPIO_PC5
 
+// The EPD bus is bit banged, the 8258 SPI master only has SCK/SDO on
+// PA4/PA2 or PD7/PB7 and this board has EPD_CLK/EPD_MOSI on PB5/PB6
+
 #define NFC_SDA		GPIO_PC0
 #define NFC_SCL		GPIO_PC1
 #define NFC_CS		GPIO_PC6
@@ -719,6 +719,49 @@ void obdCreateVirtualDisplay(OBDISP *pOBD, int width, int height, uint8_t *buffe
     pOBD->iScreenOffset = 0;
   }
 } /* obdCreateVirtualDisplay() */
+
+//
+// Create a virtual display in the layout of an e-paper frame buffer
+//
+void obdCreateVirtualEPD(OBDISP *pOBD, int width, int height, uint8_t *buffer)
+{
+  obdCreateVirtualDisplay(pOBD, width, height, buffer);
+  if (pOBD != NULL && buffer != NULL)
+    pOBD->type = LCD_VIRTUAL_EPD;
+} /* obdCreateVirtualEPD() */
+
+//
+// Byte of an LCD_VIRTUAL_EPD display holding pixel x,y as bit 0x80 >> (y & 7)
+//
+static uint8_t *obdEPDByte(OBDISP *pOBD, int x, int y)
+{
+  return &pOBD->ucScreen[(pOBD->width - 1 - x) * (pOBD->height >> 3) + (y >> 3)];
+} /* obdEPDByte() */
+
+//
+// Draw rows y1 to y2 of column x on an LCD_VIRTUAL_EPD display
+// A column is a run of bytes there, so only the two ends need masks
+//
+static void obdEPDSpan(OBDISP *pOBD, int x, int y1, int y2, uint8_t ucColor)
+{
+uint8_t *d, ucMask;
+int i, iLen;
+
+  d = obdEPDByte(pOBD, x, y1);
+  iLen = (y2 >> 3) - (y1 >> 3);
+  for (i=0; i<=iLen; i++, d++)
+  {
+    ucMask = 0xff;
+    if (i == 0)
+      ucMask >>= (y1 & 7);
+    if (i == iLen)
+      ucMask &= 0xff << (7 - (y2 & 7));
+    if (ucColor)
+      *d &= ~ucMask;
+    else
+      *d |= ucMask;
+  }
+} /* obdEPDSpan() */
 //
 // Scroll the internal buffer by 1 scanline (up/down)
 // width is in pixels, lines is group of 8 rows
@@ -779,7 +822,7 @@ int iPitch = pOBD->width;
     
   pOBD->iScreenOffset = (y*iPitch)+x;
   
-  if (pOBD->type == LCD_VIRTUAL || pOBD->type >= SHARP_144x168)
+  if (pOBD->type == LCD_VIRTUAL || pOBD->type == LCD_VIRTUAL_EPD || pOBD->type >= SHARP_144x168)
     return; // nothing to do
   if (!bRender)
       return; // don't send the commands to the OLED if we're not rendering the graphics now
@@ -851,7 +894,7 @@ if (pOBD->ucScreen && (iLen + pOBD->iScreenOffset) <= iBufferSize)
   if (pOBD->iScreenOffset >= iBufferSize)
     pOBD->iScreenOffset -= iBufferSize;
 }
-if (pOBD->type == LCD_VIRTUAL || pOBD->type >= SHARP_144x168)
+if (pOBD->type == LCD_VIRTUAL || pOBD->type == LCD_VIRTUAL_EPD || pOBD->type >= SHARP_144x168)
   return; // nothing else to do
 } /* obdWriteDataBlock() */
 //
@@ -1156,6 +1199,13 @@ int i;
 unsigned char uc, ucOld;
 int iPitch, iSize;
 
+  if (pOBD->type == LCD_VIRTUAL_EPD)
+  {
+    if (x < 0 || y < 0 || x >= pOBD->width || y >= pOBD->height)
+      return -1;
+    obdEPDSpan(pOBD, x, y, y, ucColor);
+    return 0;
+  }
   iPitch = pOBD->width;
   iSize = iPitch * (pOBD->height/8);
 
@@ -1751,24 +1801,151 @@ int miny, maxy;
    *bottom = maxy;
 } /* obdGetStringBox() */
 
+//
+// Get up to 8 bits (MSB first) from a packed glyph bitmap
+// Only touches the bytes holding those bits, so it never reads past the font
+//
+static uint8_t obdGetGlyphBits(const uint8_t *s, int iBitOff, int iCount)
+{
+uint8_t uc;
+int iShift = iBitOff & 7;
+
+   s += iBitOff >> 3;
+   uc = pgm_read_byte(s) << iShift;
+   if (iShift + iCount > 8)
+      uc |= pgm_read_byte(&s[1]) >> (8 - iShift);
+   return uc & (uint8_t)(0xff00 >> iCount);
+} /* obdGetGlyphBits() */
+
+//
+// State of an RLE glyph being unpacked row by row, see OBD_FONT_RLE
+//
+typedef struct {
+   const uint8_t *pFlags; // rows repeating the one above
+   const uint8_t *pRuns;
+   int iNibble; // next run length
+   int iRun; // pixels left in the current run
+   int iRow;
+   uint8_t ucInk, bToggle;
+} OBDRLE;
+
+//
+// Unpack the next row of an RLE glyph into MSB first bytes
+// pPrev is the row above, long runs are filled a byte at a time
+//
+static void obdRLERow(OBDRLE *pRLE, uint8_t *pDst, const uint8_t *pPrev, int iWidth)
+{
+int x, n, iRun, iNibble, iBytes;
+uint8_t uc, ucInk, bToggle;
+
+   iWidth = (iWidth < OBD_RLE_MAX_WIDTH) ? iWidth : OBD_RLE_MAX_WIDTH;
+   iBytes = (iWidth + 7) >> 3;
+   uc = pgm_read_byte(&pRLE->pFlags[pRLE->iRow >> 3]);
+   if (uc & (0x80 >> (pRLE->iRow++ & 7))) {
+      for (x=0; x<iBytes; x++)
+         pDst[x] = pPrev[x];
+      return;
+   }
+   for (x=0; x<iBytes; x++)
+      pDst[x] = 0;
+   // locals, as pDst could alias the state
+   iRun = pRLE->iRun; iNibble = pRLE->iNibble;
+   ucInk = pRLE->ucInk; bToggle = pRLE->bToggle;
+   for (x=0; x<iWidth; ) {
+      while (iRun == 0) { // next run
+         if (bToggle)
+            ucInk ^= 1;
+         uc = pgm_read_byte(&pRLE->pRuns[iNibble >> 1]);
+         iRun = (iNibble++ & 1) ? (uc & 0xf) : (uc >> 4);
+         bToggle = (iRun < 15);
+      }
+      n = (iWidth - x < iRun) ? iWidth - x : iRun;
+      iRun -= n;
+      if (!ucInk) {
+         x += n;
+         continue;
+      }
+      // set n bits from x on, whole bytes in the middle
+      if ((x & 7) + n <= 8) {
+         pDst[x >> 3] |= (uint8_t)(0xff << (8 - n)) >> (x & 7);
+         x += n;
+         continue;
+      }
+      pDst[x >> 3] |= 0xff >> (x & 7);
+      n -= 8 - (x & 7);
+      x = (x | 7) + 1;
+      for (; n >= 8; n -= 8, x += 8)
+         pDst[x >> 3] = 0xff;
+      if (n) {
+         pDst[x >> 3] |= (uint8_t)(0xff << (8 - n));
+         x += n;
+      }
+   }
+   pRLE->iRun = iRun; pRLE->iNibble = iNibble;
+   pRLE->ucInk = ucInk; pRLE->bToggle = bToggle;
+} /* obdRLERow() */
+
+//
+// Transpose 8 rows of 8 pixels (MSB = left) into 8 columns in the
+// vertical byte layout of the back buffer (LSB = top row)
+//
+static void obdTranspose8(uint8_t *pRows, uint8_t *pCols)
+{
+uint32_t x, y, t;
+
+   // rows go in bottom first so the top row ends up in the LSB
+   x = ((uint32_t)pRows[7] << 24) | (pRows[6] << 16) | (pRows[5] << 8) | pRows[4];
+   y = ((uint32_t)pRows[3] << 24) | (pRows[2] << 16) | (pRows[1] << 8) | pRows[0];
+   t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+   t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+   t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+   t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+   t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+   y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+   x = t;
+   pCols[0] = x >> 24; pCols[1] = x >> 16; pCols[2] = x >> 8; pCols[3] = x;
+   pCols[4] = y >> 24; pCols[5] = y >> 16; pCols[6] = y >> 8; pCols[7] = y;
+} /* obdTranspose8() */
+
 //
 // Draw a string of characters in a custom font
 // A back buffer must be defined
+// Each glyph is cut into blocks of 8x8 pixels which are turned into whole
+// bytes of the back buffer. On a text line starting at a multiple of 8 a
+// column byte lands in a single page, else it is shifted across two
+// RLE fonts are unpacked 8 rows at a time as the blocks need them
 //
 int obdWriteStringCustom(OBDISP *pOBD, GFXfont *pFont, int x, int y, char *szMsg, uint8_t ucColor)
 {
-int i, end_y, dx, dy, tx, ty, c, iBitOff;
-uint8_t *s, *d, bits, ucMask, ucClr, uc;
+int i, j, c, dx, dy, tx, ty, bx, by, w, h, iCols, iStart, iShift, iPages, iBitOff;
+int iColStep, iPageStep, bEPD;
+uint8_t *s, *d, ucRows[8], ucCols[8], uc, ucAll, ucMask, ucMask2, ucSet, ucLast;
+uint16_t us;
+uint8_t ucBand[8][OBD_RLE_MAX_WIDTH / 8];
+OBDRLE rle;
 GFXfont font;
-GFXglyph glyph, *pGlyph;
+GFXglyph glyph;
 int iPitch;
    
    if (pOBD == NULL || pFont == NULL || pOBD->ucScreen == NULL || x < 0)
       return -1;
    iPitch = pOBD->width;
+   iPages = (pOBD->height + 7) >> 3;
+   // rows of a partial last page below the display height stay untouched
+   ucLast = (pOBD->height & 7) ? (1 << (pOBD->height & 7)) - 1 : 0xff;
+   ucSet = (ucColor) ? 0xff : 0;
+   // where the next column and the next page of a byte are
+   bEPD = (pOBD->type == LCD_VIRTUAL_EPD);
+   iColStep = 1;
+   iPageStep = iPitch;
+   if (bEPD) // bytes get mirrored and inverted on the way
+   {
+      iColStep = -iPages;
+      iPageStep = 1;
+      ucSet = ~ucSet;
+   }
    // in case of running on AVR, get copy of data from FLASH
    memcpy_P(&font, pFont, sizeof(font));
-   pGlyph = &glyph;
 
    i = 0;
    while (szMsg[i] && x < pOBD->width)
@@ -1778,55 +1955,94 @@ int iPitch;
          continue; // skip it
       c -= font.first; // first char of font defined
       memcpy_P(&glyph, &font.glyph[c], sizeof(glyph));
-      dx = x + pGlyph->xOffset; // offset from character UL to start drawing
-      dy = y + pGlyph->yOffset;
-      s = font.bitmap + pGlyph->bitmapOffset; // start of bitmap data
-      // Bitmap drawing loop. Image is MSB first and each pixel is packed next
-      // to the next (continuing on to the next character line)
-      iBitOff = 0; // bitmap offset (in bits)
-      bits = uc = 0; // bits left in this font byte
-      end_y = dy + pGlyph->height;
-      if (dy < 0) { // skip these lines
-          iBitOff += (pGlyph->width * (-dy));
-          dy = 0;
+      dx = x + glyph.xOffset; // offset from character UL to start drawing
+      dy = y + glyph.yOffset;
+      s = font.bitmap + glyph.bitmapOffset; // start of bitmap data
+      w = glyph.width;
+      h = glyph.height;
+      if (font.flags & OBD_FONT_RLE) {
+         if (w > OBD_RLE_MAX_WIDTH)
+            w = 0; // not from fontc.py, skip it
+         memset(&rle, 0, sizeof(rle));
+         rle.pFlags = s;
+         rle.pRuns = s + ((h + 7) >> 3);
       }
-      for (ty=dy; ty<end_y && ty < pOBD->height; ty++) {
-         ucMask = 1<<(ty & 7); // destination bit number for this line
-         ucClr = (ucColor) ? ucMask : 0;
-         d = &pOBD->ucScreen[(ty >> 3) * iPitch + dx]; // internal buffer dest
-         for (tx=0; tx<pGlyph->width; tx++) {
-            if (uc == 0) { // need to read more font data
-               tx += bits; // skip any remaining 0 bits
-               uc = pgm_read_byte(&s[iBitOff>>3]); // get more font bitmap data
-               bits = 8 - (iBitOff & 7); // we might not be on a byte boundary
-               iBitOff += bits; // because of a clipped line
-               uc <<= (8-bits);
-               if (tx >= pGlyph->width) {
-                  while(tx >= pGlyph->width) { // rolls into next line(s)
-                     tx -= pGlyph->width;
-                     ty++;
-                  }
-                  if (ty >= end_y || ty >= pOBD->height) { // we're past the end
-                     tx = pGlyph->width;
-                     continue; // exit this character cleanly
-                  }
-                  // need to recalculate mask and offset in case Y changed
-                  ucMask = 1<<(ty & 7); // destination bit number for this line
-                  ucClr = (ucColor) ? ucMask : 0;
-                  d = &pOBD->ucScreen[(ty >> 3) * iPitch + dx]; // internal buffer dest
-               }
-            } // if we ran out of bits
-            if (uc & 0x80) { // set pixel
-               if (ucClr)
-                  d[tx] |= ucMask;
+      for (by=0; by<h && dy+by < pOBD->height; by+=8) {
+         if ((font.flags & OBD_FONT_RLE) && w) {
+            // row 7 still holds the row above this band
+            for (ty=0; ty<8; ty++) {
+               if (by+ty < h)
+                  obdRLERow(&rle, ucBand[ty], ucBand[(ty - 1) & 7], w);
+               else
+                  memset(ucBand[ty], 0, sizeof(ucBand[0]));
+            }
+         }
+         for (bx=0; bx<w; bx+=8) {
+            iCols = (w - bx < 8) ? w - bx : 8;
+            uc = 0;
+            ucAll = 0xff;
+            iBitOff = by * w + bx;
+            for (ty=0; ty<8; ty++, iBitOff += w) {
+               if (font.flags & OBD_FONT_RLE)
+                  ucRows[ty] = ucBand[ty][bx >> 3];
                else
-                  d[tx] &= ~ucMask;
+                  ucRows[ty] = (by+ty < h) ? obdGetGlyphBits(s, iBitOff, iCols) : 0;
+               uc |= ucRows[ty];
+               ucAll &= ucRows[ty];
+            }
+            if (!uc) // nothing to draw in this block
+               continue;
+            if (ucAll == (uint8_t)(0xff00 >> iCols)) // solid, common in bold digits
+               memset(ucCols, 0xff, sizeof(ucCols));
+            else
+               obdTranspose8(ucRows, ucCols);
+            // clip the block once, all its columns share rows and pages
+            tx = dx + bx;
+            iStart = (tx < 0) ? -tx : 0;
+            if (tx + iCols > pOBD->width)
+               iCols = pOBD->width - tx;
+            ty = dy + by; // display row of the LSB
+            if (ty <= -8 || iStart >= iCols)
+               continue;
+            j = ty >> 3; // page of the low byte
+            iShift = ty & 7;
+            if (j < 0) { // starts above the display, only what shifts into the top page
+               j = 0;
+               iShift -= 8;
             }
-            bits--; // next bit
-            uc <<= 1;
-         } // for x
-      } // for y
-      x += pGlyph->xAdvance; // width of this character
+            tx += iStart;
+            if (bEPD)
+               d = &pOBD->ucScreen[(pOBD->width - 1 - tx) * iPages + j];
+            else
+               d = &pOBD->ucScreen[j * iPitch + tx];
+            ucMask = (j == iPages-1) ? ucLast : 0xff;
+            if (iShift == 0) { // byte aligned, each column is one byte
+               for (c=iStart; c<iCols; c++, d+=iColStep) {
+                  uc = ucCols[c] & ucMask;
+                  if (bEPD) uc = ucMirror[uc];
+                  *d = (*d & ~uc) | (uc & ucSet);
+               }
+            } else if (iShift > 0 && j+1 < iPages) { // split across two pages
+               ucMask2 = (j+1 == iPages-1) ? ucLast : 0xff;
+               for (c=iStart; c<iCols; c++, d+=iColStep) {
+                  us = ucCols[c] << iShift;
+                  uc = (uint8_t)us & ucMask;
+                  if (bEPD) uc = ucMirror[uc];
+                  d[0] = (d[0] & ~uc) | (uc & ucSet);
+                  uc = (uint8_t)(us >> 8) & ucMask2;
+                  if (bEPD) uc = ucMirror[uc];
+                  d[iPageStep] = (d[iPageStep] & ~uc) | (uc & ucSet);
+               }
+            } else { // the other page is off the display
+               for (c=iStart; c<iCols; c++, d+=iColStep) {
+                  uc = ((iShift < 0) ? ucCols[c] >> -iShift : ucCols[c] << iShift) & ucMask;
+                  if (bEPD) uc = ucMirror[uc];
+                  *d = (*d & ~uc) | (uc & ucSet);
+               }
+            }
+         } // for bx
+      } // for by
+      x += glyph.xAdvance; // width of this character
    } // while drawing characters
    return 0;
 } /* obdWriteStringCustom() */
@@ -1864,8 +2080,11 @@ uint8_t y;
 uint8_t iLines;
 
   pOBD->iCursorX = pOBD->iCursorY = 0;
-  if (pOBD->type == LCD_VIRTUAL || pOBD->type >= SHARP_144x168) // pure memory, handle it differently
+  if (pOBD->type == LCD_VIRTUAL || pOBD->type == LCD_VIRTUAL_EPD || pOBD->type >= SHARP_144x168) // pure memory, handle it differently
   {
+     // the same byte pattern upside down and inverted in the e-paper layout
+     if (pOBD->type == LCD_VIRTUAL_EPD)
+        ucData = ~ucMirror[ucData];
      if (pOBD->ucScreen)
         memset(pOBD->ucScreen, ucData, pOBD->width * (pOBD->height/8));
      return;
@@ -1908,6 +2127,42 @@ void obdDrawLine(OBDISP *pOBD, int x1, int y1, int x2, int y2, uint8_t ucColor,
   if (x1 < 0 || x2 < 0 || y1 < 0 || y2 < 0 || x1 >= pOBD->width || x2 >= pOBD->width || y1 >= pOBD->height || y2 >= pOBD->height)
      return;
 
+  if (pOBD->type == LCD_VIRTUAL_EPD) // same steps as below, one pixel at a time
+  {
+    if (abs(dx) > abs(dy)) {
+      if (x2 < x1) {
+        temp = x1; x1 = x2; x2 = temp;
+        temp = y1; y1 = y2; y2 = temp;
+      }
+      dx = x2 - x1;
+      dy = y2 - y1;
+      yinc = (dy < 0) ? -1 : 1;
+      dy = abs(dy);
+      error = dx >> 1;
+      for (x=x1, y=y1; x <= x2; x++) {
+        obdEPDSpan(pOBD, x, y, y, ucColor);
+        error -= dy;
+        if (error < 0) { error += dx; y += yinc; }
+      }
+    } else {
+      if (y2 < y1) {
+        temp = x1; x1 = x2; x2 = temp;
+        temp = y1; y1 = y2; y2 = temp;
+      }
+      dx = x2 - x1;
+      dy = y2 - y1;
+      xinc = (dx < 0) ? -1 : 1;
+      dx = abs(dx);
+      error = dy >> 1;
+      for (x=x1, y=y1; y <= y2; y++) {
+        obdEPDSpan(pOBD, x, y, y, ucColor);
+        error -= dx;
+        if (error < 0) { error += dy; x += xinc; }
+      }
+    }
+    return;
+  }
+
   if(abs(dx) > abs(dy)) {
     // X major case
     if(x2 < x1) {
@@ -2179,6 +2434,20 @@ void obdRectangle(OBDISP *pOBD, int x1, int y1, int x2, int y2, uint8_t ucColor,
         y1 = y2;
         y2 = tmp;
     }
+    if (pOBD->type == LCD_VIRTUAL_EPD)
+    {
+        for (tmp = x1; tmp <= x2; tmp++)
+        {
+            if (bFilled || tmp == x1 || tmp == x2)
+                obdEPDSpan(pOBD, tmp, y1, y2, ucColor);
+            else
+            {
+                obdEPDSpan(pOBD, tmp, y1, y1, ucColor);
+                obdEPDSpan(pOBD, tmp, y2, y2, ucColor);
+            }
+        }
+        return;
+    }
     if (bFilled)
     {
         int x, y, iMiddle;
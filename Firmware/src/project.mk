@@ -3,17 +3,31 @@ $(OUT_PATH)/app.o \
 $(OUT_PATH)/app_att.o \
 $(OUT_PATH)/battery.o \
 $(OUT_PATH)/ble.o \
+$(OUT_PATH)/ble_conn.o \
+$(OUT_PATH)/broadcast.o \
+$(OUT_PATH)/broadcast_frame.o \
 $(OUT_PATH)/epd_ble_service.o \
 $(OUT_PATH)/i2c.o \
 $(OUT_PATH)/cmd_parser.o \
 $(OUT_PATH)/flash.o \
 $(OUT_PATH)/time.o \
+$(OUT_PATH)/schedule.o \
 $(OUT_PATH)/epd_spi.o \
 $(OUT_PATH)/epd.o \
+$(OUT_PATH)/epd_diff.o \
+$(OUT_PATH)/epd_plane.o \
+$(OUT_PATH)/epd_rotate.o \
+$(OUT_PATH)/epd_xfer.o \
+$(OUT_PATH)/epd_slot.o \
+$(OUT_PATH)/epd_template.o \
+$(OUT_PATH)/epd_text.o \
+$(OUT_PATH)/epd_driver.o \
 $(OUT_PATH)/epd_bw_213.o \
 $(OUT_PATH)/epd_bwr_213.o \
 $(OUT_PATH)/epd_bw_213_ice.o \
 $(OUT_PATH)/epd_bwr_154.o \
+$(OUT_PATH)/epd_bwr_350.o \
+$(OUT_PATH)/epd_bwy_350.o \
 $(OUT_PATH)/ota.o \
 $(OUT_PATH)/led.o \
 $(OUT_PATH)/uart.o \
@@ -0,0 +1,92 @@
+#include <stdint.h>
+#include "tl_common.h"
+#include "main.h"
+#include "drivers.h"
+
+#include "schedule.h"
+#include "epd.h"
+#include "epd_ble_service.h"
+#include "time.h"
+
+#define SCHEDULE_MAGIC 0x53434844
+
+typedef struct
+{
+    uint32_t magic;
+    schedule_entry_t entry[SCHEDULE_MAX];
+} schedule_table_t;
+
+RAM schedule_table_t schedule;
+RAM uint32_t schedule_checked = 0; // entries up to this get_time() are handled
+
+void init_schedule(void)
+{
+    flash_read_page(SCHEDULE_FLASH_ADDR, sizeof(schedule), (uint8_t *)&schedule);
+    if (schedule.magic != SCHEDULE_MAGIC)
+        schedule_clear();
+}
+
+// Returns 0 for an index out of range, an action of SCHEDULE_NONE deletes the entry
+_attribute_ram_code_ uint8_t schedule_set(uint8_t index, const schedule_entry_t *entry)
+{
+    if (index >= SCHEDULE_MAX)
+        return 0;
+    schedule.entry[index] = *entry;
+    return 1;
+}
+
+_attribute_ram_code_ void schedule_clear(void)
+{
+    memset(&schedule, 0, sizeof(schedule));
+    schedule.magic = SCHEDULE_MAGIC;
+}
+
+_attribute_ram_code_ void schedule_save(void)
+{
+    flash_erase_sector(SCHEDULE_FLASH_ADDR);
+    flash_write_page(SCHEDULE_FLASH_ADDR, sizeof(schedule), (uint8_t *)&schedule);
+}
+
+_attribute_ram_code_ uint8_t schedule_count(void)
+{
+    uint8_t i, count = 0;
+
+    for (i = 0; i < SCHEDULE_MAX; i++)
+        if (schedule.entry[i].action != SCHEDULE_NONE)
+            count++;
+    return count;
+}
+
+// Once a second, the latest entry that came due since the last check wins, so
+// after the clock was set only the current state gets shown
+_attribute_ram_code_ void schedule_handler(void)
+{
+    uint32_t now = get_time();
+    const schedule_entry_t *due = NULL;
+    uint8_t i;
+
+    // A template draws into epd_buffer and a slot replaces the accent plane, so
+    // wait for a running update and for an upload the host has not finished
+    if (now == schedule_checked || epd_update_running() || epd_ble_upload_running())
+        return;
+    // The clock was set back, show what is due at the new time
+    if (now < schedule_checked)
+        schedule_checked = 0;
+
+    for (i = 0; i < SCHEDULE_MAX; i++)
+    {
+        const schedule_entry_t *e = &schedule.entry[i];
+        if (e->action == SCHEDULE_NONE || e->time > now || e->time <= schedule_checked)
+            continue;
+        if (!due || e->time > due->time)
+            due = e;
+    }
+    schedule_checked = now;
+    if (!due)
+        return;
+
+    if (due->action == SCHEDULE_SLOT)
+        epd_display_slot(due->arg, due->full_or_partial);
+    else if (due->action == SCHEDULE_TEMPLATE)
+        epd_display_template(due->arg, due->full_or_partial);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+// Display changes at a given unix time, evaluated against get_time() so they
+// happen without a connection. Kept in its own sector behind the settings.
+// An entry is shown once the clock passes its time, when the clock jumps only
+// the latest entry due is. Nothing about that is stored: after a reset the clock
+// starts at 0 again and setting it shows the current entry over the boot screen
+#define SCHEDULE_FLASH_ADDR 0x79000
+#define SCHEDULE_MAX 31 // the table fits one flash page
+
+#define SCHEDULE_NONE 0
+#define SCHEDULE_SLOT 1 // show flash slot arg, see epd_slot.h
+#define SCHEDULE_TEMPLATE 2 // render template arg with the fields as they are then, see epd_template.h
+
+typedef struct
+{
+    uint32_t time;
+    uint8_t action;
+    uint8_t arg;
+    uint8_t full_or_partial;
+    uint8_t reserved;
+} schedule_entry_t;
+
+void init_schedule(void);
+uint8_t schedule_set(uint8_t index, const schedule_entry_t *entry);
+void schedule_clear(void);
+void schedule_save(void);
+uint8_t schedule_count(void);
+void schedule_handler(void);
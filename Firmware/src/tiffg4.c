@@ -877,6 +877,11 @@ uint32_t ulBits, ulBitOff;
 uint8_t *pBuf, *pBufEnd;
 
     xsize = pPage->iWidth; /* For performance reasons */
+    if (xsize + 2 > MAX_IMAGE_WIDTH) // flip arrays sized at build time
+    {
+        pPage->iError = TIFF_INVALID_PARAMETER;
+        return 0;
+    }
     CurFlips = pPage->CurFlips;
     RefFlips = pPage->RefFlips;
     
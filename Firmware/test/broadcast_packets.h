@@ -0,0 +1,13 @@
+// Generated by: python3 broadcast.py --c > test/broadcast_packets.h
+static const uint8_t bcast_test_key[16] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+static const uint8_t bcast_everyone[] = {0x1a, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x65, 0x53, 0xf1, 0x00, 0x01, 0x02, 0x03, 0x01, 0x0f, 0xab, 0x5b, 0xe1};
+static const uint8_t bcast_only_b[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x02, 0x01, 0x02, 0x05, 0x00, 0x4c, 0x5c, 0x0c, 0x08};
+static const uint8_t bcast_group_9[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x66, 0x02, 0x00, 0x09, 0x00, 0x01, 0x02, 0x06, 0x01, 0x26, 0x68, 0xd8, 0xeb};
+static const uint8_t bcast_price[] = {0x1b, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x07, 0x00, 0x03, 0x05, 0x00, 0x34, 0x2e, 0x39, 0x39, 0x04, 0x02, 0x00, 0x00, 0x41, 0x69, 0x92, 0x8e};
+static const uint8_t bcast_forged[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x00, 0x10, 0x86, 0x6d, 0x9f};
+static const uint8_t bcast_wrong_key[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x01, 0x7f, 0x6c, 0x2b, 0x51};
+static const uint8_t bcast_old[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x0c, 0x31, 0xca, 0x9f};
+static const uint8_t bcast_for_a[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x0a, 0x01, 0xd4, 0x9d, 0x3a, 0x00};
+static const uint8_t bcast_for_b[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x02, 0x01, 0x02, 0x0b, 0x01, 0xdd, 0x49, 0x28, 0x57};
+static const uint8_t bcast_group_8[] = {0x14, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x08, 0x00, 0x01, 0x02, 0x0c, 0x01, 0xa7, 0xdd, 0x0a, 0x93};
+static const uint8_t bcast_cut_tlv[] = {0x17, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0d, 0x01, 0x01, 0x05, 0x0e, 0x81, 0x1a, 0xaf, 0xaa};
@@ -0,0 +1,210 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "tl_common.h"
+#include "main.h"
+#include "mock_epd.h"
+
+mock_bus_byte_t mock_bus[MOCK_BUS_MAX];
+int mock_bus_len;
+uint32_t mock_cycles;
+uint32_t mock_gpio_writes;
+int mock_timing_errors;
+uint8_t mock_read_value;
+uint8_t mock_busy = 1;
+
+// Minimum bus timing in ns, as listed in epd_spi.c
+#define T_CYCLE 100
+#define T_HIGH 35
+#define T_LOW 35
+#define T_SETUP 10
+#define T_HOLD 40
+#define T_CS_SETUP 60
+#define T_CS_HOLD 65
+#define T_CS_HIGH 100
+
+static uint8_t pin_cs = 1, pin_clk = 1, pin_mosi, pin_dc, mosi_out = 1;
+static uint32_t t_cs_fall, t_cs_rise, t_clk_rise, t_clk_fall, t_mosi;
+static uint8_t first_edge, bits, shift, read_bits;
+
+uint32_t mock_ns(uint32_t cycles)
+{
+    return cycles * 1000 / MOCK_CPU_MHZ;
+}
+
+static void timing(const char *what, uint32_t since, uint32_t min_ns)
+{
+    if (mock_ns(mock_cycles - since) < min_ns)
+    {
+        if (mock_timing_errors++ < 5)
+            printf("  bus timing: %s %uns < %uns\n", what, mock_ns(mock_cycles - since), min_ns);
+    }
+}
+
+void mock_reset(void)
+{
+    mock_bus_len = 0;
+    mock_cycles = 0;
+    mock_gpio_writes = 0;
+    mock_timing_errors = 0;
+    pin_cs = 1;
+    pin_clk = 1;
+    mosi_out = 1;
+    bits = 0;
+    t_cs_rise = t_clk_rise = t_clk_fall = t_mosi = 0;
+}
+
+static void clk_rise(void)
+{
+    if (pin_cs)
+        return;
+    if (!mosi_out) // a read, the controller drives SDA
+    {
+        read_bits++;
+        return;
+    }
+    timing("SDA setup", t_mosi, T_SETUP);
+    timing("SCL low", t_clk_fall, T_LOW);
+    if (first_edge)
+        timing("CS setup", t_cs_fall, T_CS_SETUP);
+    else
+        timing("SCL cycle", t_clk_rise, T_CYCLE);
+    first_edge = 0;
+    t_clk_rise = mock_cycles;
+    shift = (shift << 1) | pin_mosi;
+    if (++bits == 8)
+    {
+        if (mock_bus_len < MOCK_BUS_MAX)
+        {
+            mock_bus[mock_bus_len].dc = pin_dc;
+            mock_bus[mock_bus_len].value = shift;
+        }
+        mock_bus_len++;
+        bits = 0;
+    }
+}
+
+void gpio_write(int pin, unsigned int value)
+{
+    value = value ? 1 : 0;
+    mock_cycles += MOCK_GPIO_CYCLES;
+    mock_gpio_writes++;
+    switch (pin)
+    {
+    case EPD_CS:
+        if (pin_cs && !value)
+        {
+            timing("CS high", t_cs_rise, T_CS_HIGH);
+            t_cs_fall = mock_cycles;
+            first_edge = 1;
+            bits = 0;
+            read_bits = 0;
+        }
+        else if (!pin_cs && value)
+        {
+            if (!first_edge)
+                timing("CS hold", t_clk_rise, T_CS_HOLD);
+            if (bits && mock_timing_errors++ < 5)
+                printf("  bus: CS released after %d bits\n", bits);
+            t_cs_rise = mock_cycles;
+        }
+        pin_cs = value;
+        break;
+    case EPD_CLK:
+        if (!pin_clk && value)
+            clk_rise();
+        else if (pin_clk && !value)
+        {
+            if (!pin_cs && !first_edge)
+                timing("SCL high", t_clk_rise, T_HIGH);
+            t_clk_fall = mock_cycles;
+        }
+        pin_clk = value;
+        break;
+    case EPD_MOSI:
+        if (value != pin_mosi && !pin_cs && !first_edge)
+            timing("SDA hold", t_clk_rise, T_HOLD);
+        if (value != pin_mosi)
+            t_mosi = mock_cycles;
+        pin_mosi = value;
+        break;
+    case EPD_DC:
+        pin_dc = value;
+        break;
+    }
+}
+
+int gpio_read(int pin)
+{
+    if (pin == EPD_BUSY)
+        return mock_busy;
+    if (pin == EPD_MOSI && !mosi_out)
+        return (mock_read_value >> (8 - read_bits)) & 1;
+    return 0;
+}
+
+void gpio_set_output_en(int pin, int en)
+{
+    if (pin == EPD_MOSI)
+        mosi_out = en;
+}
+
+void gpio_set_func(int pin, int func)
+{
+}
+
+void gpio_set_input_en(int pin, int en)
+{
+}
+
+void gpio_setup_up_down_resistor(int pin, int mode)
+{
+}
+
+void gpio_shutdown(int pin)
+{
+}
+
+void WaitUs(unsigned int us)
+{
+    mock_cycles += us * MOCK_CPU_MHZ;
+}
+
+void WaitMs(unsigned int ms)
+{
+    mock_cycles += ms * 1000 * MOCK_CPU_MHZ;
+}
+
+int mock_bus_data(int *pos, const uint8_t *data, int len)
+{
+    int i;
+
+    if (*pos + len > mock_bus_len)
+        return 0;
+    for (i = 0; i < len; i++)
+    {
+        if (!mock_bus[*pos + i].dc || mock_bus[*pos + i].value != data[i])
+            return 0;
+    }
+    *pos += len;
+    return 1;
+}
+
+int mock_bus_expect(int *pos, uint8_t cmd, const uint8_t *data, int len)
+{
+    int next = *pos + 1;
+
+    if (*pos >= mock_bus_len || mock_bus[*pos].dc || mock_bus[*pos].value != cmd || !mock_bus_data(&next, data, len))
+        return 0;
+    *pos = next;
+    return 1;
+}
+
+// What the driver sequences call in epd.c and epd_slot.c, images come from epd_buffer only here
+void epd_stream_tiff(uint8_t *pData, int iSize, uint16_t ram_y_start, uint8_t cmd)
+{
+}
+
+void epd_slot_send(uint32_t addr, int size, uint8_t invert)
+{
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+// Mock of the EPD pins: decodes the bit banged bus into the bytes the
+// controller receives and keeps a lower bound of the CPU time spent on it
+
+typedef struct
+{
+    uint8_t dc; // 0 = command, 1 = data
+    uint8_t value;
+} mock_bus_byte_t;
+
+#define MOCK_BUS_MAX 40000
+#define MOCK_CPU_MHZ 24
+#define MOCK_GPIO_CYCLES 3 // a gpio_write is a read-modify-write of the output register
+
+extern mock_bus_byte_t mock_bus[MOCK_BUS_MAX];
+extern int mock_bus_len;
+extern uint32_t mock_cycles;     // pin writes and delays only, the code around them is free
+extern uint32_t mock_gpio_writes;
+extern int mock_timing_errors;   // bus timing below the figures in epd_spi.c
+extern uint8_t mock_read_value;  // what the controller answers to EPD_SPI_read
+extern uint8_t mock_busy;        // level of the BUSY pin
+
+void mock_reset(void);
+// Returns 1 if the bus carried exactly cmd followed by len data bytes, starting at *pos
+int mock_bus_expect(int *pos, uint8_t cmd, const uint8_t *data, int len);
+// The same for data bytes only
+int mock_bus_data(int *pos, const uint8_t *data, int len);
+uint32_t mock_ns(uint32_t cycles);
+
+#ifdef EPD_OP_FIRST
+// Replays seq to its end, skipping the waits
+static inline void mock_seq_run(const epd_driver_t *drv, const uint8_t *seq, epd_job_t *job)
+{
+    uint16_t pos = 0;
+
+    while (epd_seq_run(drv, seq, &pos, job) != EPD_STEP_DONE)
+        ;
+}
+#endif
@@ -0,0 +1 @@
+// Nothing the host tests need, see tl_common.h
@@ -0,0 +1,43 @@
+#pragma once
+
+// Stands in for the Telink SDK headers on the host, only what the modules
+// under test use. The pins and delays are implemented by mock_epd.c, the
+// flash by the tests that need it
+#include <stdint.h>
+#include <string.h>
+
+#define _attribute_ram_code_
+#define _attribute_data_retention_
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+
+enum
+{
+    GPIO_PA0 = 0x000 | 0x01, GPIO_PA1 = 0x000 | 0x02, GPIO_PA2 = 0x000 | 0x04, GPIO_PA3 = 0x000 | 0x08,
+    GPIO_PA4 = 0x000 | 0x10, GPIO_PA5 = 0x000 | 0x20, GPIO_PA6 = 0x000 | 0x40, GPIO_PA7 = 0x000 | 0x80,
+    GPIO_PB0 = 0x100 | 0x01, GPIO_PB1 = 0x100 | 0x02, GPIO_PB2 = 0x100 | 0x04, GPIO_PB3 = 0x100 | 0x08,
+    GPIO_PB4 = 0x100 | 0x10, GPIO_PB5 = 0x100 | 0x20, GPIO_PB6 = 0x100 | 0x40, GPIO_PB7 = 0x100 | 0x80,
+    GPIO_PC0 = 0x200 | 0x01, GPIO_PC1 = 0x200 | 0x02, GPIO_PC2 = 0x200 | 0x04, GPIO_PC3 = 0x200 | 0x08,
+    GPIO_PC4 = 0x200 | 0x10, GPIO_PC5 = 0x200 | 0x20, GPIO_PC6 = 0x200 | 0x40, GPIO_PC7 = 0x200 | 0x80,
+    GPIO_PD0 = 0x300 | 0x01, GPIO_PD1 = 0x300 | 0x02, GPIO_PD2 = 0x300 | 0x04, GPIO_PD3 = 0x300 | 0x08,
+    GPIO_PD4 = 0x300 | 0x10, GPIO_PD5 = 0x300 | 0x20, GPIO_PD6 = 0x300 | 0x40, GPIO_PD7 = 0x300 | 0x80,
+};
+
+#define AS_GPIO 0
+#define PM_PIN_PULLUP_1M 1
+
+void gpio_set_func(int pin, int func);
+void gpio_set_output_en(int pin, int en);
+void gpio_set_input_en(int pin, int en);
+void gpio_setup_up_down_resistor(int pin, int mode);
+void gpio_shutdown(int pin);
+void gpio_write(int pin, unsigned int value);
+int gpio_read(int pin);
+void WaitUs(unsigned int us);
+void WaitMs(unsigned int ms);
+
+void flash_erase_sector(unsigned long addr);
+void flash_write_page(unsigned long addr, unsigned long len, unsigned char *buf);
+void flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf);
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdio.h>
+
+// Each test is a small program, it prints what failed and exits non zero
+static int test_failures;
+
+#define CHECK(cond)                                                        \
+    do                                                                     \
+    {                                                                      \
+        if (!(cond))                                                       \
+        {                                                                  \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            test_failures++;                                               \
+        }                                                                  \
+    } while (0)
+
+#define TEST_DONE()                                                    \
+    do                                                                 \
+    {                                                                  \
+        printf("%s: %s\n", __FILE__, test_failures ? "FAILED" : "ok"); \
+        return test_failures != 0;                                     \
+    } while (0)
@@ -0,0 +1,121 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "broadcast_frame.h"
+#include "host_aes.h"
+#include "test.h"
+#include "broadcast_packets.h"
+
+// A label as broadcast.c runs it, with the commands it took
+typedef struct
+{
+    uint8_t mac[6];
+    uint16_t groups[2];
+    uint32_t counter;
+    uint8_t actions[64];
+    int actions_len;
+} label_t;
+
+#define RECEIVE(l, packet) receive(l, packet, sizeof(packet))
+
+static uint8_t receive(label_t *l, const uint8_t *adv, int len)
+{
+    uint8_t key[16], type, cmd_len;
+    const uint8_t *payload, *value;
+    bcast_frame_t f;
+    int pos = 0;
+
+    memcpy(key, bcast_test_key, sizeof(key));
+    len = bcast_find(adv, len, &payload);
+    if (!len || !bcast_parse(payload, len, key, host_aes_encrypt, &f))
+        return 0;
+    if (!bcast_accept(&f, &l->counter, l->mac, l->groups, 2))
+        return 0;
+    while ((pos = bcast_cmd_next(&f, pos, &type, &value, &cmd_len)))
+    {
+        l->actions[l->actions_len++] = type;
+        l->actions[l->actions_len++] = cmd_len;
+        memcpy(&l->actions[l->actions_len], value, cmd_len);
+        l->actions_len += cmd_len;
+    }
+    return 1;
+}
+
+int main(void)
+{
+    // FIPS-197 appendix C.1
+    static const uint8_t fips_out[16] = {0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+                                         0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a};
+    // What broadcast.py expects of its simulated labels
+    static const uint8_t common[] = {BCAST_CMD_TIME, 4, 0x65, 0x53, 0xf1, 0x00, BCAST_CMD_SLOT, 2, 0x03, 0x01};
+    static const uint8_t a_actions[] = {BCAST_CMD_FIELD, 5, 0x00, '4', '.', '9', '9', BCAST_CMD_TEMPLATE, 2, 0x00, 0x00,
+                                        BCAST_CMD_SLOT, 2, 0x0a, 0x01, BCAST_CMD_SLOT, 2, 0x0d, 0x01};
+    static const uint8_t b_actions[] = {BCAST_CMD_SLOT, 2, 0x05, 0x00, BCAST_CMD_SLOT, 2, 0x06, 0x01,
+                                        BCAST_CMD_SLOT, 2, 0x0b, 0x01, BCAST_CMD_SLOT, 2, 0x0c, 0x01};
+    label_t a = {{0x01, 0x00, 0x00, 0x38, 0xC1, 0xA4}, {7, 0}}, b = {{0x02, 0x00, 0x00, 0x38, 0xC1, 0xA4}, {8, 9}};
+    uint8_t key[16], plain[16], out[16], adv[32];
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        key[i] = i;
+        plain[i] = i * 0x11;
+    }
+    host_aes_encrypt(key, plain, out);
+    CHECK(memcmp(out, fips_out, 16) == 0);
+
+    // Everyone, a repeat and a packet for the other label
+    CHECK(RECEIVE(&a, bcast_everyone) && RECEIVE(&b, bcast_everyone));
+    CHECK(!RECEIVE(&a, bcast_everyone));
+    CHECK(!RECEIVE(&a, bcast_only_b) && RECEIVE(&b, bcast_only_b));
+    CHECK(a.counter == 100);
+
+    // Groups
+    CHECK(!RECEIVE(&a, bcast_group_9) && RECEIVE(&b, bcast_group_9));
+    CHECK(RECEIVE(&a, bcast_price) && !RECEIVE(&b, bcast_price));
+
+    // Tampered, signed with another key, an old counter
+    CHECK(!RECEIVE(&a, bcast_forged));
+    CHECK(!RECEIVE(&a, bcast_wrong_key));
+    CHECK(!RECEIVE(&b, bcast_old));
+    CHECK(a.counter == 103 && b.counter == 102);
+
+    // Any flipped bit or a cut off tag is refused
+    for (i = 0; i < 8 * (int)sizeof(bcast_everyone); i++)
+    {
+        label_t c = {{0x03}};
+
+        memcpy(adv, bcast_everyone, sizeof(bcast_everyone));
+        adv[i / 8] ^= 0x80 >> (i & 7);
+        CHECK(!receive(&c, adv, sizeof(bcast_everyone)));
+    }
+    {
+        label_t c = {{0x03}};
+
+        memcpy(adv, bcast_everyone, sizeof(bcast_everyone));
+        adv[0]--;
+        CHECK(!receive(&c, adv, sizeof(bcast_everyone) - 1));
+    }
+
+    // One transmitter going through its labels: a hears the packets for the
+    // others first and still takes its own with a lower counter
+    CHECK(!RECEIVE(&a, bcast_group_8));
+    CHECK(!RECEIVE(&a, bcast_for_b));
+    CHECK(RECEIVE(&a, bcast_for_a));
+    CHECK(!RECEIVE(&b, bcast_for_a));
+    CHECK(RECEIVE(&b, bcast_for_b));
+    CHECK(RECEIVE(&b, bcast_group_8));
+    CHECK(a.counter == 110 && b.counter == 112);
+
+    // A command claiming more bytes than are left is dropped, the one before runs
+    CHECK(RECEIVE(&a, bcast_cut_tlv));
+
+    CHECK(a.actions_len == sizeof(common) + sizeof(a_actions));
+    CHECK(memcmp(a.actions, common, sizeof(common)) == 0);
+    CHECK(memcmp(&a.actions[sizeof(common)], a_actions, sizeof(a_actions)) == 0);
+    CHECK(b.actions_len == sizeof(common) + sizeof(b_actions));
+    CHECK(memcmp(b.actions, common, sizeof(common)) == 0);
+    CHECK(memcmp(&b.actions[sizeof(common)], b_actions, sizeof(b_actions)) == 0);
+
+    TEST_DONE();
+}
@@ -0,0 +1,172 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+// For the static tile hash
+#include "epd_diff.c"
+
+static uint8_t last[epd_buffer_size], next[epd_buffer_size];
+
+// Bit n of the top left tile, 16 bits per line
+#define TILE_BYTE(n) (((n) >> 3) % EPD_DIFF_TILE_W + ((n) >> 4) * epd_line_bytes)
+#define TILE_BIT(n) (0x80 >> ((n) & 7))
+
+// Every changed byte has to be inside one of the windows
+static int covered(const epd_window_t *rects, int count)
+{
+    int i, x, y, hit;
+
+    for (y = 0; y < epd_width; y++)
+    {
+        for (x = 0; x < epd_line_bytes; x++)
+        {
+            if (last[y * epd_line_bytes + x] == next[y * epd_line_bytes + x])
+                continue;
+            hit = 0;
+            for (i = 0; i < count; i++)
+                hit |= x >= rects[i].x && x < rects[i].x + rects[i].w && y >= rects[i].y && y < rects[i].y + rects[i].h;
+            if (!hit)
+                return 0;
+        }
+    }
+    return 1;
+}
+
+static void fill_rect(uint8_t *image, int x0, int y0, int x1, int y1)
+{
+    int x, y;
+
+    for (y = y0; y < y1; y++)
+        for (x = x0; x < x1; x++)
+            image[y * epd_line_bytes + x] = rand();
+}
+
+// A changed price field, text line, scattered pixels or the whole frame
+static void churn(int pattern)
+{
+    int i;
+
+    memcpy(next, last, sizeof(next));
+    switch (pattern)
+    {
+    case 0: // price digits, 64 px high and 100 lines long
+        fill_rect(next, 4, 120, 12, 220);
+        break;
+    case 1: // a 16 px text line
+        fill_rect(next, 12, 20, 14, 200);
+        break;
+    case 2: // a battery icon and a clock
+        fill_rect(next, 0, 230, 2, 248);
+        fill_rect(next, 8, 10, 12, 60);
+        break;
+    case 3: // 20 single pixels all over
+        for (i = 0; i < 20; i++)
+            next[rand() % sizeof(next)] ^= 0x80 >> (rand() & 7);
+        break;
+    case 4:
+        fill_rect(next, 0, 0, epd_line_bytes, epd_width);
+        break;
+    }
+}
+
+int main(void)
+{
+    static const char *names[] = {"price", "text line", "icon + clock", "20 pixels", "full frame"};
+    epd_window_t rects[EPD_DIFF_MAX_RECTS];
+    uint32_t hash;
+    int a, b, c, i, n, p, bytes, round, total[5] = {0};
+
+    // No change of 1 to 3 bits in a tile goes unnoticed
+    srand(7);
+    for (i = 0; i < epd_buffer_size; i++)
+        last[i] = rand();
+    hash = epd_diff_hash_tile(last, 0, 0);
+    for (a = 0; a < 128; a++)
+    {
+        for (b = a; b < 128; b++)
+        {
+            for (c = b; c < 128; c++)
+            {
+                memcpy(next, last, epd_buffer_size);
+                next[TILE_BYTE(a)] ^= TILE_BIT(a);
+                if (b != a)
+                    next[TILE_BYTE(b)] ^= TILE_BIT(b);
+                if (c != b)
+                    next[TILE_BYTE(c)] ^= TILE_BIT(c);
+                if (epd_diff_hash_tile(next, 0, 0) == hash)
+                {
+                    printf("bits %d %d %d collide\n", a, b, c);
+                    test_failures++;
+                }
+            }
+        }
+    }
+
+    // Without a stored frame the whole frame is sent
+    epd_diff_invalidate();
+    CHECK(epd_diff_find(last, rects, EPD_DIFF_MAX_RECTS) == 1);
+    CHECK(rects[0].x == 0 && rects[0].w == epd_line_bytes && rects[0].y == 0 && rects[0].h == epd_width);
+
+    // A failed update does not store anything, the same diff comes out again
+    epd_diff_store(last);
+    CHECK(epd_diff_find(last, rects, EPD_DIFF_MAX_RECTS) == 0);
+    churn(0);
+    n = epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS);
+    CHECK(n == 1 && covered(rects, n));
+    CHECK(epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS) == n);
+    epd_diff_store(next);
+    CHECK(epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS) == 0);
+
+    // A window pushed by the host: what it covers is on the panel, a change
+    // next to it and the tiles it cuts still have to be sent
+    {
+        epd_window_t win = {5, 4, 20, 13}; // cuts tiles on both sides and at the bottom
+
+        epd_diff_store(last);
+        memcpy(next, last, sizeof(next));
+        fill_rect(next, 0, 0, epd_line_bytes, 64);
+        epd_diff_store_window(next, &win);
+        n = epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS);
+        CHECK(covered(rects, n));
+        CHECK(n == 1 && rects[0].y == 0 && rects[0].h == 64);
+        epd_diff_store(next);
+        CHECK(epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS) == 0);
+
+        // Inside whole tiles, nothing is left
+        memcpy(last, next, sizeof(last));
+        fill_rect(next, 4, 24, 8, 40);
+        win = (epd_window_t){4, 4, 24, 16};
+        epd_diff_store_window(next, &win);
+        CHECK(epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS) == 0);
+
+        // Cut tiles stay dirty even if the bytes next to the window match
+        memcpy(last, next, sizeof(last));
+        win = (epd_window_t){5, 1, 30, 2};
+        epd_diff_store_window(next, &win);
+        n = epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS);
+        CHECK(n == 1 && rects[0].x == 4 && rects[0].w == 2 && rects[0].y == 24 && rects[0].h == 8);
+        epd_diff_store(next);
+        memcpy(last, next, sizeof(last));
+    }
+
+    // Bytes sent for typical label churn, against the 4000 of a full frame
+    epd_diff_store(last);
+    for (round = 0; round < 100; round++)
+    {
+        for (p = 0; p < 5; p++)
+        {
+            churn(p);
+            n = epd_diff_find(next, rects, EPD_DIFF_MAX_RECTS);
+            CHECK(covered(rects, n));
+            for (i = 0, bytes = 0; i < n; i++)
+                bytes += rects[i].w * rects[i].h;
+            total[p] += bytes;
+            epd_diff_store(next);
+            memcpy(last, next, sizeof(last));
+        }
+    }
+    for (p = 0; p < 5; p++)
+        printf("%-13s %5d bytes (%d%%)\n", names[p], total[p] / 100, total[p] / epd_buffer_size);
+
+    TEST_DONE();
+}
@@ -0,0 +1,128 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "epd.h"
+#include "epd_plane.h"
+#include "test.h"
+
+static uint8_t plane[epd_buffer_size], out[epd_buffer_size + 16];
+static int out_len;
+
+static void feed(const uint8_t *data, int len)
+{
+    memcpy(&out[out_len], data, len);
+    out_len += len;
+}
+
+static void fill(uint8_t value, int len)
+{
+    memset(&out[out_len], value, len);
+    out_len += len;
+}
+
+// Unpacks epd_accent in pieces of 1 to max_piece bytes, the way BLE writes arrive
+static int unpack_pieces(int size, int pos, int max_piece)
+{
+    epd_unpack_t u;
+    int i, n, end = pos;
+
+    epd_unpack_start(&u, out, size, pos);
+    for (i = 0; i < epd_accent_len; i += n)
+    {
+        n = 1 + rand() % max_piece;
+        if (n > epd_accent_len - i)
+            n = epd_accent_len - i;
+        end = epd_unpack_feed(&u, &epd_accent[i], n);
+    }
+    return end;
+}
+
+// A label: white with text blocks, a few lines of it changing from frame to frame
+static void make_label(int text_blocks)
+{
+    int i, x, y, x0, y0;
+
+    memset(plane, 0xff, sizeof(plane));
+    for (i = 0; i < text_blocks; i++)
+    {
+        x0 = rand() % 12;
+        y0 = rand() % 200;
+        for (y = y0; y < y0 + 40; y++)
+            for (x = x0; x < x0 + 3; x++)
+                plane[y * epd_line_bytes + x] = rand() | rand();
+    }
+}
+
+static double seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    static const int blocks[] = {0, 1, 2, 3}; // as much as fits EPD_ACCENT_MAX packed
+    uint16_t packed;
+    int i, b, round;
+    double start;
+
+    // Runs and literals at their limits and around them
+    srand(11);
+    for (i = 0; i < epd_buffer_size; i++)
+    {
+        int kind = (i / 130) % 4;
+        plane[i] = kind == 0 ? 0xff : kind == 1 ? i : kind == 2 ? (i / 2) : rand();
+    }
+    for (round = 0; round < 50; round++)
+    {
+        int size = 1 + rand() % 700;
+        packed = epd_accent_pack(plane + round, size, round & 1);
+        CHECK(packed > 0);
+        out_len = 0;
+        epd_accent_send(size, feed, fill);
+        for (i = 0; i < size; i++)
+            out[i] ^= (round & 1) ? 0xff : 0x00;
+        CHECK(out_len == size && memcmp(out, plane + round, size) == 0);
+        memset(out, 0x55, sizeof(out));
+        CHECK(unpack_pieces(size, 0, 20) == size);
+        for (i = 0; i < size; i++)
+            out[i] ^= (round & 1) ? 0xff : 0x00;
+        CHECK(memcmp(out, plane + round, size) == 0);
+    }
+
+    // Starting at a position, anything beyond size is dropped
+    packed = epd_accent_pack(plane, 600, 0);
+    memset(out, 0x55, sizeof(out));
+    CHECK(unpack_pieces(500, 100, 7) == 500);
+    CHECK(memcmp(&out[100], plane, 400) == 0);
+    CHECK(out[0] == 0x55 && out[99] == 0x55 && out[500] == 0x55);
+
+    // Sent short, the rest is no accent. Too big to keep, no plane at all
+    out_len = 0;
+    epd_accent_send(800, feed, fill);
+    CHECK(out_len == 800 && memcmp(out, plane, 600) == 0 && out[600] == 0 && out[799] == 0);
+    for (i = 0; i < epd_buffer_size; i++)
+        plane[i] = rand();
+    CHECK(epd_accent_pack(plane, epd_buffer_size, 0) == 0);
+    CHECK(epd_accent_len == 0);
+
+    // Label frames: packed size, BLE writes of 19 bytes and unpack time
+    printf("text blocks  packed  writes (raw 211)  unpack\n");
+    for (b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++)
+    {
+        make_label(blocks[b]);
+        packed = epd_accent_pack(plane, epd_buffer_size, 0);
+        CHECK(packed > 0);
+        start = seconds();
+        for (round = 0; round < 1000; round++)
+            CHECK(unpack_pieces(epd_buffer_size, 0, 19) == epd_buffer_size);
+        CHECK(memcmp(out, plane, epd_buffer_size) == 0);
+        printf("%11d  %6d  %6d            %.1f us\n", blocks[b], packed, (packed + 18) / 19,
+               (seconds() - start) * 1e6 / 1000);
+    }
+
+    TEST_DONE();
+}
@@ -0,0 +1,114 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include "tl_common.h"
+#include "main.h"
+#include "epd_spi.h"
+#include "epd_driver.h"
+#include "epd_plane.h"
+#include "epd_bwr_213.h"
+#include "epd_bwy_350.h"
+#include "mock_epd.h"
+#include "test.h"
+
+static uint8_t image[epd_buffer_size], accent[epd_buffer_size], inverted[epd_buffer_size];
+
+// A label: text all over the black plane, a red price box and a red bar in the accent plane
+static void make_label(int line_bytes, int lines)
+{
+    int i, x, y;
+
+    srand(8);
+    memset(image, 0xff, sizeof(image));
+    memset(accent, 0x00, sizeof(accent));
+    for (i = 0; i < line_bytes * lines; i++)
+    {
+        if (rand() % 4 == 0)
+            image[i] = rand();
+    }
+    for (y = 100; y < 200 && y < lines; y++)
+        for (x = 2; x < line_bytes - 2; x++)
+            accent[y * line_bytes + x] = 0xff;
+    for (y = 0; y < 16; y++)
+        for (x = 0; x < line_bytes; x++)
+            accent[y * line_bytes + x] = 0xff;
+}
+
+// Both planes go to their RAM from address 0, then the refresh
+static void check_frame(const uint8_t *black, const uint8_t *red, int size, int partial)
+{
+    static const uint8_t ram_y[] = {0x28, 0x01};
+    int pos = 0, lut = 0;
+
+    CHECK(mock_bus_expect(&pos, 0x4E, (const uint8_t *)"\x00", 1));
+    CHECK(mock_bus_expect(&pos, 0x4F, ram_y, 2));
+    CHECK(mock_bus_expect(&pos, 0x24, black, size));
+    CHECK(mock_bus_expect(&pos, 0x4E, (const uint8_t *)"\x00", 1));
+    CHECK(mock_bus_expect(&pos, 0x4F, ram_y, 2));
+    CHECK(mock_bus_expect(&pos, 0x26, red, size));
+    mock_bus_expect(&pos, 0x22, (const uint8_t *)"\x40", 1); // BWY350 only
+    for (; pos < mock_bus_len && (mock_bus[pos].dc || mock_bus[pos].value == 0x32); pos++)
+        lut++;
+    CHECK(partial ? lut > 0 : lut == 0);
+    CHECK(mock_bus_expect(&pos, 0x22, (const uint8_t *)"\xC7", 1));
+    CHECK(mock_bus_expect(&pos, 0x20, NULL, 0));
+    CHECK(pos == mock_bus_len);
+    CHECK(mock_timing_errors == 0);
+}
+
+int main(void)
+{
+    const epd_driver_t *bwy = &epd_driver_bwy_350;
+    epd_job_t job = {0};
+    uint16_t packed;
+    int i, size;
+
+    // Full refresh of the 2.13" BWR, the accent plane is kept packed and sent unpacked
+    make_label(epd_line_bytes, epd_width);
+    packed = epd_accent_pack(accent, epd_buffer_size, 0);
+    CHECK(packed > 0);
+    job.kind = EPD_JOB_DISPLAY;
+    job.image = image;
+    job.size = epd_buffer_size;
+    job.full_or_partial = 1;
+    mock_reset();
+    mock_seq_run(&epd_driver_bwr_213, epd_driver_bwr_213.display, &job);
+    check_frame(image, accent, epd_buffer_size, 0);
+    printf("BWR213 label: accent plane kept in %d of %d bytes, %d bytes on the bus, >= %u us\n",
+           packed, epd_buffer_size, mock_bus_len, mock_ns(mock_cycles) / 1000);
+
+    // The same as partial refresh loads the LUT first
+    job.full_or_partial = 0;
+    mock_reset();
+    mock_seq_run(&epd_driver_bwr_213, epd_driver_bwr_213.display, &job);
+    check_frame(image, accent, epd_buffer_size, 1);
+
+    // A TIFF marks the accent with black = 0, so it is packed inverted
+    for (i = 0; i < epd_buffer_size; i++)
+        inverted[i] = ~accent[i];
+    CHECK(epd_accent_pack(inverted, epd_buffer_size, 1) == packed);
+    job.full_or_partial = 1;
+    mock_reset();
+    mock_seq_run(&epd_driver_bwr_213, epd_driver_bwr_213.display, &job);
+    check_frame(image, accent, epd_buffer_size, 0);
+
+    // BWY350 frames are 213 lines of 13 bytes, an uploaded plane that stops
+    // early is filled up with no accent
+    size = EPD_FRAME_BYTES(bwy);
+    make_label(EPD_LINE_BYTES(bwy), bwy->width);
+    epd_accent_pack(accent, size / 2, 0);
+    memset(&accent[size / 2], 0x00, size - size / 2);
+    job.size = size;
+    mock_reset();
+    mock_seq_run(bwy, bwy->display, &job);
+    check_frame(image, accent, size, 0);
+
+    // Without an accent plane the red RAM is cleared
+    epd_accent_clear();
+    CHECK(epd_accent_dirty);
+    memset(accent, 0x00, sizeof(accent));
+    mock_reset();
+    mock_seq_run(bwy, bwy->display, &job);
+    check_frame(image, accent, size, 0);
+
+    TEST_DONE();
+}
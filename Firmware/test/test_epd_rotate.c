@@ -0,0 +1,130 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "epd_rotate.h"
+#include "test.h"
+
+// Per pixel: bit 7 - k of out[j] is pixel j of in[k], MSB first
+static void ref_transpose8(const uint8_t *in, int in_step, uint8_t *out, int out_step)
+{
+    int j, k;
+
+    for (j = 0; j < 8; j++)
+    {
+        uint8_t v = 0;
+        for (k = 0; k < 8; k++)
+            if (in[k * in_step] & (0x80 >> j))
+                v |= 0x80 >> k;
+        out[j * out_step] = v;
+    }
+}
+
+// How TIFFDraw rotated a band before epd_rotate_band, one pixel at a time
+static void ref_rotate_band(const uint8_t band[8][EPD_BAND_PITCH], int width, uint8_t *dst, int dst_step)
+{
+    int x, k;
+
+    for (x = 0; x < width; x++)
+    {
+        uint8_t v = 0;
+        for (k = 0; k < 8; k++)
+            if (band[k][x / 8] & (0x80 >> (x & 7)))
+                v |= 0x80 >> k;
+        dst[x * dst_step] = v;
+    }
+}
+
+static uint8_t band[8][EPD_BAND_PITCH];
+static uint8_t frame[260 * 16], ref_frame[260 * 16], visited[(260 * 16 + 7) / 8];
+
+static double seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    // Bands x panel width of every panel, and the edge cases
+    static const int shapes[][2] = {{16, 250}, {13, 213}, {16, 200}, {1, 250}, {250, 1}, {16, 16}, {7, 3}};
+    uint8_t in[8], out[8], ref[8];
+    int i, k, r, c, width, line, round;
+    double start, fast, slow;
+
+    // Every single pixel, then random blocks
+    for (i = 0; i < 64; i++)
+    {
+        memset(in, 0, sizeof(in));
+        in[i / 8] = 0x80 >> (i & 7);
+        epd_transpose8(in, 1, out, 1);
+        ref_transpose8(in, 1, ref, 1);
+        CHECK(memcmp(out, ref, 8) == 0);
+    }
+    srand(10);
+    for (i = 0; i < 100000; i++)
+    {
+        for (k = 0; k < 8; k++)
+            in[k] = rand();
+        epd_transpose8(in, 1, out, 1);
+        ref_transpose8(in, 1, ref, 1);
+        if (memcmp(out, ref, 8))
+        {
+            CHECK(memcmp(out, ref, 8) == 0);
+            break;
+        }
+    }
+
+    // Bands of any width into a frame rotated like TIFFDraw, nothing outside the band is touched
+    for (width = 1; width <= EPD_BAND_PITCH * 8; width++)
+    {
+        for (k = 0; k < 8; k++)
+            for (i = 0; i < EPD_BAND_PITCH; i++)
+                band[k][i] = rand();
+        memset(frame, 0x55, sizeof(frame));
+        memset(ref_frame, 0x55, sizeof(ref_frame));
+        epd_rotate_band(band, width, &frame[(width - 1) * 16 + 3], -16);
+        ref_rotate_band(band, width, &ref_frame[(width - 1) * 16 + 3], -16);
+        if (memcmp(frame, ref_frame, sizeof(frame)))
+        {
+            printf("width %d\n", width);
+            CHECK(memcmp(frame, ref_frame, sizeof(frame)) == 0);
+            break;
+        }
+    }
+
+    // Lines of column bytes turned into the columns of a frame in place
+    for (i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++)
+    {
+        for (k = 0; k < shapes[i][0] * shapes[i][1]; k++)
+            frame[k] = rand();
+        for (r = 0; r < shapes[i][0]; r++)
+            for (c = 0; c < shapes[i][1]; c++)
+                ref_frame[c * shapes[i][0] + r] = frame[r * shapes[i][1] + c];
+        epd_transpose_bytes(frame, shapes[i][0], shapes[i][1], visited);
+        CHECK(memcmp(frame, ref_frame, shapes[i][0] * shapes[i][1]) == 0);
+    }
+    start = seconds();
+    for (round = 0; round < 2000; round++)
+        epd_transpose_bytes(frame, 16, 250, visited);
+    printf("16 x 250 bytes transposed in place: %.1f us\n", (seconds() - start) / 2000 * 1e6);
+
+    // A 250 x 128 frame, 16 bands
+    start = seconds();
+    for (round = 0; round < 2000; round++)
+        for (line = 0; line < 16; line++)
+            epd_rotate_band(band, 250, &frame[249 * 16 + line], -16);
+    fast = (seconds() - start) / 2000;
+    start = seconds();
+    for (round = 0; round < 2000; round++)
+        for (line = 0; line < 16; line++)
+            ref_rotate_band(band, 250, &ref_frame[249 * 16 + line], -16);
+    slow = (seconds() - start) / 2000;
+    CHECK(memcmp(frame, ref_frame, sizeof(frame)) == 0);
+    CHECK(fast < slow);
+    printf("250x128 frame: %.1f us, per pixel %.1f us (%.1fx)\n", fast * 1e6, slow * 1e6, slow / fast);
+
+    TEST_DONE();
+}
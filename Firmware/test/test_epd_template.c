@@ -0,0 +1,176 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "OneBitDisplay.h"
+#include "epd_template.h"
+#include "epd_text.h"
+#include "test.h"
+
+#define PROGMEM
+#include "font16.h"
+#include "font30.h"
+
+const GFXfont *const epd_fonts[] = {&Dialog_plain_16, &Special_Elite_Regular_30};
+const uint8_t epd_font_count = sizeof(epd_fonts) / sizeof(epd_fonts[0]);
+
+// The flash as NOR flash, with the furthest byte a read has reached
+static uint8_t flash[0x80000];
+static uint32_t flash_read_end;
+
+void flash_erase_sector(unsigned long addr)
+{
+    memset(&flash[addr & ~0xfff], 0xff, 0x1000);
+}
+
+void flash_write_page(unsigned long addr, unsigned long len, unsigned char *buf)
+{
+    unsigned long i;
+
+    for (i = 0; i < len; i++)
+        flash[addr + i] &= buf[i];
+}
+
+void flash_read_page(unsigned long addr, unsigned long len, unsigned char *buf)
+{
+    memcpy(buf, &flash[addr], len);
+    if (addr + len > flash_read_end)
+        flash_read_end = addr + len;
+}
+
+#define TPL 1
+#define TPL_DATA (EPD_TEMPLATE_BASE + TPL * 0x1000 + EPD_TEMPLATE_DATA)
+
+static uint8_t screen[250 * 16], ref_screen[250 * 16];
+static uint8_t tpl[512];
+static int tpl_len, item_end[16], items;
+
+static void add(const uint8_t *item, int len)
+{
+    memcpy(&tpl[tpl_len], item, len);
+    tpl_len += len;
+    item_end[items++] = tpl_len;
+}
+
+static const uint8_t bitmap[] = {0xF0, 0x30, 0x0F, 0xC0, 0xAA, 0x50, 0x55, 0xA0, 0xFF, 0xF0, 0x81, 0x10, 0x00, 0x00, 0x3C, 0x30};
+static const char long_text[] = "A text of 70 characters, only the first 63 of them fit the item buffer";
+
+// What the first n items of the template draw, with the calls they stand for
+static void ref_draw(OBDISP *obd, int n)
+{
+    static const uint8_t box_fonts[] = {1, 0, 0xff, 0xff};
+    int x, y;
+
+    if (n > 0) // field 0, centered on 125
+        obdWriteStringCustom(obd, (GFXfont *)&Dialog_plain_16, 125 - epd_text_width(&Dialog_plain_16, "Apples", 255) / 2, 20,
+                             "Apples", 1);
+    if (n > 1) // right aligned to 240
+        obdWriteStringCustom(obd, (GFXfont *)&Special_Elite_Regular_30, 240 - epd_text_width(&Special_Elite_Regular_30, "4.99", 255),
+                             70, "4.99", 1);
+    if (n > 2)
+        obdRectangle(obd, 5, 5, 100, 40, 1, 0);
+    if (n > 3)
+        obdDrawLine(obd, 0, 110, 249, 110, 1, 0);
+    if (n > 4)
+    {
+        for (y = 0; y < 8; y++)
+            for (x = 0; x < 12; x++)
+                obdSetPixel(obd, 10 + x, 80 + y, (bitmap[y * 2 + (x >> 3)] >> (7 - (x & 7))) & 1, 0);
+    }
+    if (n > 5)
+        epd_text_draw(obd, box_fonts, 4, EPD_TEXT_WRAP | EPD_ALIGN_CENTER | EPD_TEXT_MIDDLE, 1, 130, 75, 110, 45, "Fresh from the farm");
+    if (n > 6) // cut to 63 characters
+    {
+        char text[64];
+
+        memcpy(text, long_text, 63);
+        text[63] = 0;
+        obdWriteStringCustom(obd, (GFXfont *)&Dialog_plain_16, 0, 125, text, 1);
+    }
+    if (n > 7)
+        obdDrawLine(obd, 0, 0, 249, 127, 1, 0);
+}
+
+// Draws template and reference on the same background
+static int draw(int len, int ref_items)
+{
+    OBDISP obd, ref_obd;
+    uint8_t ok;
+
+    CHECK(epd_template_store(TPL, tpl, len));
+    obdCreateVirtualDisplay(&obd, 250, 128, screen);
+    obdCreateVirtualDisplay(&ref_obd, 250, 128, ref_screen);
+    memset(screen, 0x00, sizeof(screen));
+    memset(ref_screen, 0x00, sizeof(ref_screen));
+    flash_read_end = 0;
+    ok = epd_template_draw(&obd, TPL);
+    ref_draw(&ref_obd, ref_items);
+    if (flash_read_end > TPL_DATA + len)
+    {
+        printf("template of %d bytes read %d bytes\n", len, flash_read_end - TPL_DATA);
+        test_failures++;
+    }
+    return ok && memcmp(screen, ref_screen, sizeof(screen)) == 0;
+}
+
+int main(void)
+{
+    static const uint8_t field[] = {EPD_ITEM_FIELD, 0, 0, EPD_ALIGN_CENTER, 1, 0, 125, 0, 20};
+    static const uint8_t text[] = {EPD_ITEM_TEXT, 1, EPD_ALIGN_RIGHT, 1, 0, 240, 0, 70, 4, '4', '.', '9', '9'};
+    static const uint8_t rect[] = {EPD_ITEM_RECT, 1, 0, 0, 5, 0, 5, 0, 100, 0, 40};
+    static const uint8_t line[] = {EPD_ITEM_LINE, 1, 0, 0, 0, 110, 0, 249, 0, 110};
+    static const uint8_t bitmap_item[] = {EPD_ITEM_BITMAP, 0, 10, 0, 80, 0, 12, 0, 8};
+    static const uint8_t box[] = {EPD_ITEM_BOX, 1, EPD_TEXT_WRAP | EPD_ALIGN_CENTER | EPD_TEXT_MIDDLE, 1, 0, 130, 0, 75, 0, 110, 0, 45, 1, 0, 0xff, 0xff};
+    static const uint8_t long_item[] = {EPD_ITEM_TEXT, 0, EPD_ALIGN_LEFT, 1, 0, 0, 0, 125, sizeof(long_text) - 1};
+    static const uint8_t diagonal[] = {EPD_ITEM_LINE, 1, 0, 0, 0, 0, 0, 249, 0, 127};
+    uint8_t *p;
+    int len, i;
+
+    epd_template_set_field(0, (const uint8_t *)"Apples", 6);
+    epd_template_set_field(1, (const uint8_t *)"Fresh from the farm", 19);
+
+    add(field, sizeof(field));
+    add(text, sizeof(text));
+    add(rect, sizeof(rect));
+    add(line, sizeof(line));
+    memcpy(&tpl[tpl_len], bitmap_item, sizeof(bitmap_item));
+    memcpy(&tpl[tpl_len + sizeof(bitmap_item)], bitmap, sizeof(bitmap));
+    add(&tpl[tpl_len], sizeof(bitmap_item) + sizeof(bitmap));
+    add(box, sizeof(box));
+    memcpy(&tpl[tpl_len], long_item, sizeof(long_item));
+    memcpy(&tpl[tpl_len + sizeof(long_item)], long_text, sizeof(long_text) - 1);
+    add(&tpl[tpl_len], sizeof(long_item) + sizeof(long_text) - 1);
+    add(diagonal, sizeof(diagonal));
+
+    // The whole template, a text longer than the buffer is cut and the item after it still drawn
+    CHECK(draw(tpl_len, items));
+    CHECK(!epd_template_draw(NULL, 0) && !epd_template_draw(NULL, EPD_TEMPLATE_COUNT));
+
+    // Cut anywhere: the items that are all there are drawn and nothing past the end is read
+    for (len = 1; len < tpl_len; len++)
+    {
+        for (i = 0; i < items && item_end[i] <= len; i++)
+            ;
+        if (!draw(len, i))
+        {
+            printf("template cut to %d bytes\n", len);
+            CHECK(0);
+            break;
+        }
+    }
+
+    // Texts and bitmaps claiming more data than the template holds
+    len = item_end[3];
+    p = &tpl[len];
+    memcpy(p, bitmap_item, sizeof(bitmap_item));
+    p[7] = 0x10; // 4096 rows
+    memcpy(&p[sizeof(bitmap_item)], bitmap, sizeof(bitmap));
+    CHECK(draw(len + sizeof(bitmap_item) + sizeof(bitmap), 4));
+    p[7] = 0;
+    p[8] = 9; // one row too many
+    CHECK(draw(len + sizeof(bitmap_item) + sizeof(bitmap), 4));
+    memcpy(p, text, sizeof(text));
+    p[8] = 200;
+    CHECK(draw(len + sizeof(text), 4));
+
+    TEST_DONE();
+}
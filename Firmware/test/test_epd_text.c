@@ -0,0 +1,167 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "OneBitDisplay.h"
+#include "epd_template.h"
+#include "epd_text.h"
+#include "test.h"
+
+#define PROGMEM
+#include "font16.h"
+#include "font30.h"
+
+const GFXfont *const epd_fonts[] = {&Dialog_plain_16, &Special_Elite_Regular_30};
+const uint8_t epd_font_count = sizeof(epd_fonts) / sizeof(epd_fonts[0]);
+
+#define WIDTH 250
+#define HEIGHT 128
+
+static uint8_t screen[WIDTH * HEIGHT / 8];
+
+// The inked pixels of the virtual display
+static int ink(int *x0, int *y0, int *x1, int *y1)
+{
+    int x, y, n = 0;
+
+    *x0 = *y0 = 10000;
+    *x1 = *y1 = -1;
+    for (y = 0; y < HEIGHT; y++)
+    {
+        for (x = 0; x < WIDTH; x++)
+        {
+            if (!(screen[(y >> 3) * WIDTH + x] & (1 << (y & 7))))
+                continue;
+            n++;
+            *x0 = x < *x0 ? x : *x0;
+            *y0 = y < *y0 ? y : *y0;
+            *x1 = x > *x1 ? x : *x1;
+            *y1 = y > *y1 ? y : *y1;
+        }
+    }
+    return n;
+}
+
+// The lines hold all of the text in order, only spaces at the breaks are dropped
+static int covers(const epd_text_layout_t *l, const char *text)
+{
+    int i, pos = 0;
+
+    for (i = 0; i < l->lines; i++)
+    {
+        while (text[pos] == ' ')
+            pos++;
+        if (l->start[i] != pos || !l->len[i] || text[pos + l->len[i] - 1] == ' ')
+            return 0;
+        pos += l->len[i];
+    }
+    while (text[pos] == ' ')
+        pos++;
+    return !text[pos];
+}
+
+int main(void)
+{
+    static const uint8_t big_first[] = {1, 0}, small[] = {0}, with_unknown[] = {0xff, 7, 1, 0};
+    static const char *const words = "Fresh apples from the farm";
+    const epd_text_layout_t *l, *l2;
+    OBDISP obd;
+    int i, x0, y0, x1, y1, align, valign;
+    char line[64];
+
+    // The largest font that fits: the box decides, unknown fonts are skipped
+    l = epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, 200, 40, "4.99");
+    CHECK(l->font == 1 && l->lines == 1 && l->len[0] == 4);
+    l = epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, 200, 20, "4.99");
+    CHECK(l->font == 0 && l->lines == 1);
+    l = epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, epd_text_width(&Special_Elite_Regular_30, "4.99", 255) - 1, 40, "4.99");
+    CHECK(l->font == 0 && l->lines == 1);
+    l = epd_text_layout(with_unknown, 4, EPD_ALIGN_LEFT, 200, 40, "4.99");
+    CHECK(l->font == 1);
+
+    // Wrapping at spaces: every line fits and the next word would not
+    l = epd_text_layout(small, 1, EPD_TEXT_WRAP, 100, 100, words);
+    CHECK(l->lines > 1 && covers(l, words));
+    for (i = 0; i < l->lines; i++)
+    {
+        CHECK(l->width[i] <= 100 && l->width[i] == epd_text_width(&Dialog_plain_16, &words[l->start[i]], l->len[i]));
+        if (i + 1 < l->lines)
+        {
+            int next = l->start[i + 1] + 1;
+
+            while (words[next] && words[next] != ' ')
+                next++;
+            CHECK(epd_text_width(&Dialog_plain_16, &words[l->start[i]], next - l->start[i]) > 100);
+        }
+    }
+    // As many lines as the height takes, the rest is dropped
+    l2 = epd_text_layout(small, 1, EPD_TEXT_WRAP, 100, 30, words);
+    CHECK(l2->lines == 1);
+    CHECK(l2->lines < l->lines && l2->start[0] == 0 && l2->len[0] == l->len[0]);
+
+    // A word wider than the box is cut where it runs out of width
+    l = epd_text_layout(small, 1, EPD_TEXT_WRAP, 60, 100, "Supercalifragilistic");
+    CHECK(l->lines > 1 && covers(l, "Supercalifragilistic"));
+    for (i = 0; i < l->lines; i++)
+        CHECK(l->width[i] <= 60);
+    l = epd_text_layout(small, 1, 0, 60, 100, "Supercalifragilistic");
+    CHECK(l->lines == 1 && l->start[0] == 0 && l->len[0] < 20 && l->width[0] <= 60);
+    CHECK(epd_text_width(&Dialog_plain_16, "Supercalifragilistic", l->len[0] + 1) > 60);
+
+    // The same text in another box, with other fonts or flags is laid out again
+    l = epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, 200, 40, "12.49");
+    CHECK(l->font == 1);
+    CHECK(epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, 200, 40, "12.49") == l);
+    CHECK(epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, 200, 20, "12.49")->font == 0);
+    CHECK(epd_text_layout(small, 1, EPD_ALIGN_LEFT, 200, 40, "12.49")->font == 0);
+    CHECK(epd_text_layout(big_first, 2, EPD_ALIGN_LEFT, 200, 40, "12.49")->font == 1);
+    l = epd_text_layout(small, 1, EPD_ALIGN_LEFT, 60, 100, "one two three");
+    CHECK(l->lines == 1);
+    CHECK(epd_text_layout(small, 1, EPD_TEXT_WRAP, 60, 100, "one two three")->lines > 1);
+
+    // Alignment: the ink sits on the named edges of the box, centered between the others
+    obdCreateVirtualDisplay(&obd, WIDTH, HEIGHT, screen);
+    for (align = EPD_ALIGN_LEFT; align <= EPD_ALIGN_RIGHT; align++)
+    {
+        for (valign = EPD_TEXT_TOP; valign <= EPD_TEXT_BOTTOM; valign += EPD_TEXT_MIDDLE)
+        {
+            memset(screen, 0, sizeof(screen));
+            epd_text_draw(&obd, small, 1, align | valign, 1, 40, 20, 150, 80, "Only today");
+            CHECK(ink(&x0, &y0, &x1, &y1));
+            CHECK(x0 >= 40 && x1 < 40 + 150 && y0 >= 20 && y1 < 20 + 80);
+            if (align == EPD_ALIGN_RIGHT) // a glyph box can end in an empty column
+                CHECK(x1 >= 40 + 150 - 2);
+            if (align == EPD_ALIGN_CENTER)
+                CHECK(abs((x0 - 40) - (40 + 150 - 1 - x1)) <= 2);
+            if (align == EPD_ALIGN_LEFT)
+                CHECK(x0 - 40 <= 2);
+            if (valign == EPD_TEXT_TOP)
+                CHECK(y0 == 20);
+            if (valign == EPD_TEXT_MIDDLE)
+                CHECK(abs((y0 - 20) - (20 + 80 - 1 - y1)) <= 1);
+            if (valign == EPD_TEXT_BOTTOM)
+                CHECK(y1 == 20 + 80 - 1);
+        }
+    }
+
+    // Wrapped lines are each aligned on their own
+    memset(screen, 0, sizeof(screen));
+    l = epd_text_layout(small, 1, EPD_TEXT_WRAP | EPD_ALIGN_RIGHT, 100, 100, words);
+    epd_text_draw(&obd, small, 1, EPD_TEXT_WRAP | EPD_ALIGN_RIGHT, 1, 100, 0, 100, 100, words);
+    for (i = 0; i < l->lines; i++)
+    {
+        uint8_t ref[WIDTH * HEIGHT / 8];
+        OBDISP ref_obd;
+
+        memcpy(line, &words[l->start[i]], l->len[i]);
+        line[l->len[i]] = 0;
+        obdCreateVirtualDisplay(&ref_obd, WIDTH, HEIGHT, ref);
+        memset(ref, 0, sizeof(ref));
+        obdWriteStringCustom(&ref_obd, (GFXfont *)&Dialog_plain_16, 200 - l->width[i], -l->top + i * Dialog_plain_16.yAdvance, line, 1);
+        // every pixel of the reference line is set on the screen
+        for (x0 = 0; x0 < sizeof(ref) && (screen[x0] & ref[x0]) == ref[x0]; x0++)
+            ;
+        CHECK(x0 == sizeof(ref));
+    }
+
+    TEST_DONE();
+}
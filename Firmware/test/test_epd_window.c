@@ -0,0 +1,62 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include "tl_common.h"
+#include "main.h"
+#include "epd_spi.h"
+#include "epd_driver.h"
+#include "epd_bwr_213.h"
+#include "mock_epd.h"
+#include "test.h"
+
+static uint8_t image[epd_buffer_size];
+
+// The bus has to carry the RAM window, the bytes inside it and nothing else of the image
+static void check_window(int *pos, const epd_window_t *win)
+{
+    uint16_t y_start = 0x128 - win->y;
+    uint16_t y_end = 0x128 - (win->y + win->h - 1);
+    uint8_t x[] = {win->x, win->x + win->w - 1};
+    uint8_t y[] = {y_start & 0xff, y_start >> 8, y_end & 0xff, y_end >> 8};
+    int i;
+
+    CHECK(mock_bus_expect(pos, 0x44, x, 2));
+    CHECK(mock_bus_expect(pos, 0x45, y, 4));
+    CHECK(mock_bus_expect(pos, 0x4E, x, 1));
+    CHECK(mock_bus_expect(pos, 0x4F, y, 2));
+    CHECK(mock_bus_expect(pos, 0x24, NULL, 0));
+    for (i = 0; i < win->h; i++)
+        CHECK(mock_bus_data(pos, &image[(win->y + i) * epd_line_bytes + win->x], win->w));
+}
+
+int main(void)
+{
+    epd_job_t job = {0};
+    const epd_window_t win[] = {{2, 3, 10, 20}, {0, 16, 249, 1}};
+    int i, pos, lut = 0;
+
+    srand(3);
+    for (i = 0; i < sizeof(image); i++)
+        image[i] = rand();
+    job.kind = EPD_JOB_WINDOW;
+    job.image = image;
+    job.win_count = 2;
+    memcpy(job.win, win, sizeof(win));
+
+    mock_reset();
+    mock_seq_run(&epd_driver_bwr_213, epd_driver_bwr_213.window, &job);
+    pos = 0;
+    check_window(&pos, &win[0]);
+    check_window(&pos, &win[1]);
+    // then the partial LUT and the refresh
+    CHECK(pos < mock_bus_len && !mock_bus[pos].dc && mock_bus[pos].value == 0x32);
+    for (; pos < mock_bus_len && (mock_bus[pos].dc || mock_bus[pos].value == 0x32); pos++)
+        lut++;
+    CHECK(lut == 154);
+    CHECK(mock_bus_expect(&pos, 0x22, (const uint8_t *)"\xC7", 1));
+    CHECK(mock_bus_expect(&pos, 0x20, NULL, 0));
+    CHECK(pos == mock_bus_len);
+    CHECK(mock_timing_errors == 0);
+    printf("2 windows, %d of %d image bytes: %d bytes on the bus\n", 3 * 20 + 16, epd_buffer_size, mock_bus_len);
+
+    TEST_DONE();
+}
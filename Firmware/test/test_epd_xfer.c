@@ -0,0 +1,145 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "epd_xfer.h"
+#include "test.h"
+
+#define SIZE 4000
+#define CHUNK 190
+#define CHUNKS 22 // the last one is 10 bytes
+
+static uint8_t image[SIZE], dst[SIZE];
+static epd_xfer_t x;
+
+static uint8_t send(int seq)
+{
+    int len = SIZE - seq * CHUNK < CHUNK ? SIZE - seq * CHUNK : CHUNK;
+
+    return epd_xfer_chunk(&x, seq, epd_crc16(&image[seq * CHUNK], len), &image[seq * CHUNK], len);
+}
+
+static int missing(void)
+{
+    uint8_t out[20];
+
+    epd_xfer_status(&x, 0, out, sizeof(out));
+    return out[0] << 8 | out[1];
+}
+
+static int has_chunk(const uint8_t *status, int seq)
+{
+    return status[4 + seq / 8] & (0x80 >> (seq & 7));
+}
+
+int main(void)
+{
+    static const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    uint8_t out[20], data[CHUNK];
+    int i, seq, order[CHUNKS];
+
+    // CRC-16/CCITT-FALSE check value
+    CHECK(epd_crc16(check, sizeof(check)) == 0x29B1);
+
+    srand(12);
+    for (i = 0; i < SIZE; i++)
+        image[i] = rand();
+
+    // Sizes that do not fit the bitmap are refused
+    CHECK(!epd_xfer_start(&x, dst, SIZE, 7, 0, 0));
+    CHECK(!epd_xfer_start(&x, dst, 0, CHUNK, 0, 0));
+    CHECK(!epd_xfer_start(&x, dst, SIZE, 0, 0, 0));
+    CHECK(!epd_xfer_open(&x));
+
+    // A chunk with a bad CRC, a wrong length or past the end is not taken
+    CHECK(epd_xfer_start(&x, dst, SIZE, CHUNK, 0, 0));
+    CHECK(x.chunks == CHUNKS && epd_xfer_open(&x) && missing() == CHUNKS);
+    memcpy(data, image, CHUNK);
+    data[17] ^= 0x04;
+    CHECK(!epd_xfer_chunk(&x, 0, epd_crc16(image, CHUNK), data, CHUNK));
+    CHECK(!epd_xfer_chunk(&x, 0, epd_crc16(image, CHUNK - 1), image, CHUNK - 1));
+    CHECK(!epd_xfer_chunk(&x, CHUNKS - 1, epd_crc16(&image[(CHUNKS - 1) * CHUNK], CHUNK), &image[(CHUNKS - 1) * CHUNK], CHUNK));
+    CHECK(!epd_xfer_chunk(&x, CHUNKS, epd_crc16(image, CHUNK), image, CHUNK));
+    CHECK(missing() == CHUNKS);
+
+    // Out of order and repeated chunks, the bitmap shows the gaps
+    for (i = 0; i < CHUNKS; i++)
+        order[i] = i;
+    for (i = CHUNKS - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1), t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+    for (i = 0; i < CHUNKS; i++)
+    {
+        if (order[i] == 3 || order[i] == CHUNKS - 1)
+            continue;
+        CHECK(send(order[i]));
+        CHECK(send(order[i])); // a repeat is taken, counted once
+    }
+    CHECK(missing() == 2 && !epd_xfer_done(&x) && epd_xfer_open(&x));
+    CHECK(epd_xfer_status(&x, 0, out, sizeof(out)) == 4 + 3);
+    for (seq = 0; seq < CHUNKS; seq++)
+        CHECK(!has_chunk(out, seq) == (seq == 3 || seq == CHUNKS - 1));
+    CHECK((out[6] & 0x03) == 0); // no chunks 22 and 23
+
+    // A status from chunk 11 on starts at chunk 8, one past the last is only the header
+    CHECK(epd_xfer_status(&x, 11, out, sizeof(out)) == 4 + 2);
+    CHECK((out[2] << 8 | out[3]) == 8 && !has_chunk(out, CHUNKS - 1 - 8) && has_chunk(out, CHUNKS - 2 - 8));
+    CHECK(epd_xfer_status(&x, 24, out, sizeof(out)) == 4);
+    CHECK(epd_xfer_status(&x, 0xfff8, out, sizeof(out)) == 4);
+    CHECK(epd_xfer_status(&x, 0, out, 5) == 5);
+
+    // Filling the gaps completes it
+    CHECK(send(CHUNKS - 1) && send(3));
+    CHECK(epd_xfer_done(&x) && !epd_xfer_open(&x) && epd_xfer_verify(&x));
+    CHECK(memcmp(dst, image, SIZE) == 0);
+
+    // A session with an id survives until it times out and only resumes with
+    // the same id, size, chunk size and CRC
+    memset(dst, 0, SIZE);
+    CHECK(epd_xfer_start(&x, dst, SIZE, CHUNK, 0x12345678, epd_crc16(image, SIZE)));
+    epd_xfer_touch(&x, 1000);
+    for (seq = 0; seq < 10; seq++)
+        CHECK(send(seq));
+    CHECK(epd_xfer_resume(&x, 0x12345678, SIZE, CHUNK, epd_crc16(image, SIZE)));
+    CHECK(!epd_xfer_resume(&x, 0x12345679, SIZE, CHUNK, epd_crc16(image, SIZE)));
+    CHECK(!epd_xfer_resume(&x, 0x12345678, SIZE - 1, CHUNK, epd_crc16(image, SIZE)));
+    CHECK(!epd_xfer_resume(&x, 0x12345678, SIZE, CHUNK + 1, epd_crc16(image, SIZE)));
+    CHECK(!epd_xfer_resume(&x, 0x12345678, SIZE, CHUNK, epd_crc16(image, SIZE) ^ 1));
+    CHECK(!epd_xfer_resume(&x, 0, SIZE, CHUNK, epd_crc16(image, SIZE)));
+    CHECK(!epd_xfer_expire(&x, 1600, 600) && epd_xfer_open(&x));
+    epd_xfer_touch(&x, 1500);
+    CHECK(!epd_xfer_expire(&x, 2000, 600) && missing() == CHUNKS - 10);
+    for (seq = 10; seq < CHUNKS; seq++)
+        CHECK(send(seq));
+    CHECK(epd_xfer_done(&x) && epd_xfer_verify(&x));
+    CHECK(!epd_xfer_expire(&x, 100000, 600) && epd_xfer_done(&x)); // a finished session is kept
+
+    CHECK(epd_xfer_start(&x, dst, SIZE, CHUNK, 0x12345678, epd_crc16(image, SIZE)));
+    epd_xfer_touch(&x, 1000);
+    CHECK(send(0));
+    CHECK(epd_xfer_expire(&x, 1601, 600));
+    CHECK(!epd_xfer_open(&x));
+    CHECK(!epd_xfer_resume(&x, 0x12345678, SIZE, CHUNK, epd_crc16(image, SIZE)));
+    CHECK(!send(1));
+
+    // A buffer changed under a finished session fails the CRC and is asked for again
+    CHECK(epd_xfer_start(&x, dst, SIZE, CHUNK, 0x12345678, epd_crc16(image, SIZE)));
+    for (seq = 0; seq < CHUNKS; seq++)
+        CHECK(send(seq));
+    dst[1234] ^= 0x10;
+    CHECK(epd_xfer_done(&x) && !epd_xfer_verify(&x));
+    CHECK(missing() == CHUNKS && epd_xfer_open(&x));
+    for (seq = 0; seq < CHUNKS; seq++)
+        CHECK(send(seq));
+    CHECK(epd_xfer_verify(&x) && memcmp(dst, image, SIZE) == 0);
+
+    // Without an id there is no CRC of the whole image to check
+    CHECK(epd_xfer_start(&x, dst, SIZE, CHUNK, 0, 0x5555));
+    for (seq = 0; seq < CHUNKS; seq++)
+        CHECK(send(seq));
+    CHECK(epd_xfer_verify(&x));
+
+    TEST_DONE();
+}
@@ -0,0 +1,110 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "OneBitDisplay.h"
+#include "test.h"
+
+#define PROGMEM
+#include "font30.h"
+#include "font30_rle.h"
+#include "font_60.h"
+#include "font_60_rle.h"
+#include "Roboto_Black_80.h"
+#include "font_80_price.h"
+
+// The fonts of "make fonts" and the plain fonts they were compiled from
+static const struct
+{
+    const char *name, *chars;
+    const GFXfont *rle, *plain;
+} fonts[] = {
+    {"Special Elite 30", NULL, &Special_Elite_Regular_30_rle, &Special_Elite_Regular_30},
+    {"DSEG14 40", NULL, &DSEG14_Classic_Mini_Regular_40_rle, &DSEG14_Classic_Mini_Regular_40},
+    {"Roboto Black 80", "0123456789.,:-%$/", &Roboto_Black_80_price, &Roboto_Black_80},
+};
+
+#define FONT_COUNT (sizeof(fonts) / sizeof(fonts[0]))
+
+static uint8_t screen[256 * 32], plain_screen[256 * 32];
+
+static double seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    static char *const prices[] = {"4.99", "12.49", "199.00", "0.89"};
+    OBDISP obd, plain_obd;
+    char text[9];
+    int f, i, n, x, y, color, round, size, failed = 0;
+    double start, rle, plain;
+
+    // The RLE decoder against the plain blit: random strings in both layouts,
+    // starting on any row of a band
+    srand(24);
+    for (round = 0; round < 30000 && !failed; round++)
+    {
+        f = round % FONT_COUNT;
+        if (round & 1)
+        {
+            obdCreateVirtualEPD(&obd, 250, 128, screen);
+            obdCreateVirtualEPD(&plain_obd, 250, 128, plain_screen);
+        }
+        else
+        {
+            obdCreateVirtualDisplay(&obd, 250, 122, screen);
+            obdCreateVirtualDisplay(&plain_obd, 250, 122, plain_screen);
+        }
+        size = 250 * 16;
+        for (i = 0; i < size; i++)
+            screen[i] = rand();
+        memcpy(plain_screen, screen, size);
+        n = 1 + rand() % 8;
+        for (i = 0; i < n; i++)
+        {
+            if (fonts[f].chars)
+                text[i] = fonts[f].chars[rand() % strlen(fonts[f].chars)];
+            else
+                text[i] = 0x20 + rand() % (0x7E - 0x20); // fontc.py drops '~', there is no glyph for it
+        }
+        text[n] = 0;
+        x = rand() % 260;
+        y = rand() % 248 - 40;
+        color = rand() & 1;
+        obdWriteStringCustom(&obd, (GFXfont *)fonts[f].rle, x, y, text, color);
+        obdWriteStringCustom(&plain_obd, (GFXfont *)fonts[f].plain, x, y, text, color);
+        if (memcmp(screen, plain_screen, size))
+        {
+            printf("%s \"%s\" at %d,%d color %d%s\n", fonts[f].name, text, x, y, color, (round & 1) ? " EPD" : "");
+            CHECK(memcmp(screen, plain_screen, size) == 0);
+            failed = 1;
+        }
+    }
+
+    // What decoding costs on top of the blit, four prices on the EPD layout
+    printf("font              RLE       plain  (4 prices)\n");
+    obdCreateVirtualEPD(&obd, 250, 128, screen);
+    obdCreateVirtualEPD(&plain_obd, 250, 128, plain_screen);
+    for (f = 0; f < FONT_COUNT; f++)
+    {
+        start = seconds();
+        for (round = 0; round < 2000; round++)
+            for (i = 0; i < 4; i++)
+                obdWriteStringCustom(&obd, (GFXfont *)fonts[f].rle, 10, 100, prices[i], round & 1);
+        rle = (seconds() - start) / 2000;
+        start = seconds();
+        for (round = 0; round < 2000; round++)
+            for (i = 0; i < 4; i++)
+                obdWriteStringCustom(&plain_obd, (GFXfont *)fonts[f].plain, 10, 100, prices[i], round & 1);
+        plain = (seconds() - start) / 2000;
+        CHECK(memcmp(screen, plain_screen, 250 * 16) == 0);
+        printf("%-16s  %5.1f us  %5.1f us\n", fonts[f].name, rle * 1e6, plain * 1e6);
+    }
+
+    TEST_DONE();
+}
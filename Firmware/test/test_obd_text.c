@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "OneBitDisplay.h"
+#include "test.h"
+
+#define PROGMEM
+#include "font16.h"
+#include "font30.h"
+#include "font_60.h"
+#include "Roboto_Black_80.h"
+
+static const GFXfont *const fonts[] = {&Dialog_plain_16, &Special_Elite_Regular_30, &DSEG14_Classic_Mini_Regular_40,
+                                       &Roboto_Black_80};
+static const char *const font_names[] = {"Dialog 16", "Special Elite 30", "DSEG14 40", "Roboto Black 80"};
+
+static uint8_t screen[256 * 32], ref_screen[256 * 32];
+
+// Pixel x,y of a virtual display, the EPD layout is mirrored and inverted
+static void ref_pixel(OBDISP *obd, uint8_t *buffer, int x, int y, int color)
+{
+    uint8_t *d, mask;
+
+    if (obd->type == LCD_VIRTUAL_EPD)
+    {
+        d = &buffer[(obd->width - 1 - x) * (obd->height >> 3) + (y >> 3)];
+        mask = 0x80 >> (y & 7);
+        color = !color;
+    }
+    else
+    {
+        d = &buffer[(y >> 3) * obd->width + x];
+        mask = 1 << (y & 7);
+    }
+    *d = color ? *d | mask : *d & ~mask;
+}
+
+// How obdWriteStringCustom drew before the 8x8 blocks, one glyph pixel at a time
+static int ref_write_string(OBDISP *obd, uint8_t *buffer, const GFXfont *font, int x, int y, const char *text, int color)
+{
+    const GFXglyph *glyph;
+    int c, gx, gy, px, py, bit;
+
+    if (x < 0)
+        return -1;
+    for (; *text && x < obd->width; text++)
+    {
+        c = (uint8_t)*text;
+        if (c < font->first || c > font->last)
+            continue;
+        glyph = &font->glyph[c - font->first];
+        for (gy = 0; gy < glyph->height; gy++)
+        {
+            for (gx = 0; gx < glyph->width; gx++)
+            {
+                bit = glyph->bitmapOffset * 8 + gy * glyph->width + gx;
+                px = x + glyph->xOffset + gx;
+                py = y + glyph->yOffset + gy;
+                if ((font->bitmap[bit >> 3] & (0x80 >> (bit & 7))) && px >= 0 && px < obd->width && py >= 0 &&
+                    py < obd->height)
+                    ref_pixel(obd, buffer, px, py, color);
+            }
+        }
+        x += glyph->xAdvance;
+    }
+    return 0;
+}
+
+static double seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    // 250 x 128 both ways, a height that ends inside a page and a square panel
+    static const struct
+    {
+        int epd, width, height;
+    } displays[] = {{0, 250, 128}, {1, 250, 128}, {0, 250, 122}, {1, 200, 200}};
+    static char *const prices[] = {"4.99", "12.49", "199.00", "0.89"};
+    OBDISP obd, ref_obd;
+    char text[9];
+    int d, f, i, n, x, y, color, round, size, failed = 0;
+    double start, fast, slow;
+
+    // Random strings all over and across the edges, in both colors on random frames
+    srand(22);
+    for (round = 0; round < 40000 && !failed; round++)
+    {
+        d = round % 4;
+        f = (round / 4) % 4;
+        if (displays[d].epd)
+        {
+            obdCreateVirtualEPD(&obd, displays[d].width, displays[d].height, screen);
+            obdCreateVirtualEPD(&ref_obd, displays[d].width, displays[d].height, ref_screen);
+        }
+        else
+        {
+            obdCreateVirtualDisplay(&obd, displays[d].width, displays[d].height, screen);
+            obdCreateVirtualDisplay(&ref_obd, displays[d].width, displays[d].height, ref_screen);
+        }
+        size = displays[d].width * ((displays[d].height + 7) >> 3);
+        for (i = 0; i < size; i++)
+            screen[i] = rand();
+        memcpy(ref_screen, screen, size);
+        n = 1 + rand() % 8;
+        for (i = 0; i < n; i++)
+            text[i] = 0x20 + rand() % (0x7E - 0x20); // no '~', the fonts have no glyph for it
+        text[n] = 0;
+        x = rand() % (displays[d].width + 20) - 10;
+        y = rand() % (displays[d].height + 120) - 40;
+        color = rand() & 1;
+        CHECK(obdWriteStringCustom(&obd, (GFXfont *)fonts[f], x, y, text, color) ==
+              ref_write_string(&ref_obd, ref_screen, fonts[f], x, y, text, color));
+        if (memcmp(screen, ref_screen, sizeof(screen)))
+        {
+            printf("%s \"%s\" at %d,%d color %d on %dx%d%s\n", font_names[f], text, x, y, color, displays[d].width,
+                   displays[d].height, displays[d].epd ? " EPD" : "");
+            CHECK(memcmp(screen, ref_screen, sizeof(screen)) == 0);
+            failed = 1;
+        }
+    }
+
+    // Prices on the 250 x 128 EPD layout, on a text line and off it
+    printf("font              blocks   per pixel  (4 prices)\n");
+    obdCreateVirtualEPD(&obd, 250, 128, screen);
+    obdCreateVirtualEPD(&ref_obd, 250, 128, ref_screen);
+    for (f = 0; f < 4; f++)
+    {
+        start = seconds();
+        for (round = 0; round < 2000; round++)
+            for (i = 0; i < 4; i++)
+                obdWriteStringCustom(&obd, (GFXfont *)fonts[f], 10, 100 + (round & 1) * 3, prices[i], round & 2);
+        fast = (seconds() - start) / 2000;
+        start = seconds();
+        for (round = 0; round < 2000; round++)
+            for (i = 0; i < 4; i++)
+                ref_write_string(&ref_obd, ref_screen, fonts[f], 10, 100 + (round & 1) * 3, prices[i], round & 2);
+        slow = (seconds() - start) / 2000;
+        CHECK(memcmp(screen, ref_screen, 250 * 16) == 0);
+        printf("%-16s  %5.1f us  %5.1f us\n", font_names[f], fast * 1e6, slow * 1e6);
+    }
+
+    TEST_DONE();
+}